@@ -0,0 +1,118 @@
+#include "receiver/GlyphAtlas.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Micro-benchmark for glyph atlas rasterization on a cache miss.
+// Usage: glyph_bench <font.ttf> [iterations] [max workers]
+// Builds the receiver's atlas (both text sizes) with 1 worker and with each
+// doubling up to max workers (default: the hardware thread count), against a
+// scratch cache directory whose file is deleted after every build, and checks
+// the glyph metrics match the single-worker build.
+
+namespace {
+
+using LiveText::AtlasGlyph;
+using LiveText::GlyphAtlas;
+
+const char* CACHE_DIR = "glyph_bench_cache";
+const std::vector<int> PIXEL_SIZES = {192, 384};    // The receiver's SMALL_FONT_SIZE and BIG_FONT_SIZE
+
+struct Result {
+    double bestMs;
+    double avgMs;
+    int workers;
+    bool ok;
+};
+
+Result run(const char* fontPath, int workers, int iterations, std::vector<AtlasGlyph>& glyphs) {
+    Result result = {1e9, 0.0, 0, true};
+    for (int i = 0; i < iterations && result.ok; ++i) {
+        GlyphAtlas atlas;
+        atlas.setWorkerCount(workers);
+        result.ok = atlas.build(fontPath, PIXEL_SIZES, GlyphAtlas::DEFAULT_WIDTH);
+        const LiveText::GlyphAtlasStats& stats = atlas.getStats();
+        std::remove(stats.cachePath.c_str());
+        if (!result.ok || stats.cacheHit) {
+            result.ok = false;
+            break;
+        }
+
+        result.bestMs = std::min(result.bestMs, stats.rasterizeMs);
+        result.avgMs += stats.rasterizeMs;
+        result.workers = stats.workers;
+
+        glyphs.clear();
+        for (size_t size = 0; size < PIXEL_SIZES.size(); ++size) {
+            for (int code = 0; code < GlyphAtlas::GLYPH_COUNT; ++code) {
+                glyphs.push_back(atlas.getGlyph(size, code));
+            }
+        }
+    }
+    result.avgMs /= iterations;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <font.ttf> [iterations] [max workers]\n", argv[0]);
+        return 1;
+    }
+    const char* fontPath = argv[1];
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    // Keep the user's cache out of it - every build must rasterize
+#ifdef _WIN32
+    _putenv_s("LIVETEXT_CACHE_DIR", CACHE_DIR);
+#else
+    setenv("LIVETEXT_CACHE_DIR", CACHE_DIR, 1);
+#endif
+
+    int hardwareThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int maxWorkers = argc > 3 ? std::atoi(argv[3]) : hardwareThreads;
+    maxWorkers = std::max(1, std::min(maxWorkers, GlyphAtlas::MAX_WORKERS));
+    std::vector<int> workerCounts = {1};
+    for (int workers = 2; workers <= maxWorkers; workers *= 2) {
+        workerCounts.push_back(workers);
+    }
+    if (workerCounts.back() != maxWorkers) {
+        workerCounts.push_back(maxWorkers);
+    }
+
+    std::printf("%d hardware threads, sizes %d and %d px, %d glyphs\n", hardwareThreads, PIXEL_SIZES[0],
+                PIXEL_SIZES[1], static_cast<int>(PIXEL_SIZES.size()) * GlyphAtlas::GLYPH_COUNT);
+    std::printf("%-7s %10s %10s %9s %s\n", "workers", "best ms", "avg ms", "speedup", "glyphs");
+
+    std::vector<AtlasGlyph> reference;
+    double singleBestMs = 0.0;
+    bool allMatch = true;
+    for (int workers : workerCounts) {
+        std::vector<AtlasGlyph> glyphs;
+        Result result = run(fontPath, workers, iterations, glyphs);
+        if (!result.ok) {
+            std::fprintf(stderr, "Could not rasterize %s with %d workers\n", fontPath, workers);
+            return 1;
+        }
+
+        bool match = true;
+        if (reference.empty()) {
+            reference = glyphs;
+            singleBestMs = result.bestMs;
+        } else {
+            match = glyphs.size() == reference.size() &&
+                    std::memcmp(glyphs.data(), reference.data(), glyphs.size() * sizeof(AtlasGlyph)) == 0;
+        }
+        allMatch = allMatch && match;
+
+        std::printf("%-7d %10.2f %10.2f %8.2fx %s\n", result.workers, result.bestMs, result.avgMs,
+                    singleBestMs / result.bestMs, match ? "match" : "DIFFER");
+    }
+
+    std::remove(CACHE_DIR);
+    return allMatch ? 0 : 1;
+}
@@ -1,4 +1,5 @@
 #include "AeronConnection.h"
+#include "TimerService.h"
 #include <iostream>
 #include <mutex>
 
@@ -8,6 +9,7 @@ namespace LiveText {
 AeronPublisher::AeronPublisher(const std::string& channel, int streamId)
     : channel_(channel)
     , streamId_(streamId)
+    , heartbeatTimer_(0)
     , running_(false)
 {
 }
@@ -39,7 +41,7 @@ bool AeronPublisher::initialize() {
 
         stats_.isConnected = true;
         running_ = true;
-        healthCheckThread_ = std::thread(&AeronPublisher::healthCheckLoop, this);
+        heartbeatTimer_ = TimerService::instance().schedule(std::chrono::seconds(1), [this]() { onHeartbeatTimer(); });
 
         return true;
     } catch (const std::exception& e) {
@@ -80,8 +82,9 @@ bool AeronPublisher::publish(const TextMessage& message) {
 
 void AeronPublisher::shutdown() {
     running_ = false;
-    if (healthCheckThread_.joinable()) {
-        healthCheckThread_.join();
+    if (heartbeatTimer_ != 0) {
+        TimerService::instance().cancel(heartbeatTimer_);
+        heartbeatTimer_ = 0;
     }
 
     if (publication_) {
@@ -103,16 +106,12 @@ bool AeronPublisher::isHealthy() const {
                 std::chrono::system_clock::now().time_since_epoch()).count() - stats_.lastHeartbeat) < 5000;
 }
 
-void AeronPublisher::healthCheckLoop() {
-    while (running_) {
-        if (publication_ && publication_->isConnected()) {
-            TextMessage heartbeat = TextMessage::createHeartbeat();
-            publish(heartbeat);
-            stats_.lastHeartbeat = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-        }
-
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+void AeronPublisher::onHeartbeatTimer() {
+    if (running_ && publication_ && publication_->isConnected()) {
+        TextMessage heartbeat = TextMessage::createHeartbeat();
+        publish(heartbeat);
+        stats_.lastHeartbeat = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
     }
 }
 
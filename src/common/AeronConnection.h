@@ -63,10 +63,10 @@ private:
 #endif
     std::unique_ptr<UdpAeronPublisher> realPublisher_;
     ConnectionStats stats_;
-    std::thread healthCheckThread_;
+    int heartbeatTimer_;    // TimerService id, 0 if none
     std::atomic<bool> running_;
 
-    void healthCheckLoop();
+    void onHeartbeatTimer();
 };
 
 class AeronSubscriber {
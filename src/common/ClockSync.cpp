@@ -0,0 +1,75 @@
+#include "ClockSync.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace LiveText {
+
+uint64_t ClockSync::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+ClockSync::ClockSync()
+    : peerId_(0)
+    , pendingPing_(0)
+    , samples_()
+    , sampleCount_(0)
+    , best_{0, 0}
+{
+    // Every receiver sees every pong on the shared feed - the id picks out its own
+    std::random_device random;
+    while (peerId_ == 0) {
+        peerId_ = random();
+    }
+}
+
+TextMessage ClockSync::makePing() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pendingPing_ = now();
+    return TextMessage::createClockPing(peerId_, pendingPing_);
+}
+
+bool ClockSync::onPong(const TextMessage& pong, uint64_t receivedAt) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Another receiver's, a stale one, or the copy from the other feed
+    if (pong.peerId != peerId_ || pendingPing_ == 0 || pong.clockTime != pendingPing_ || receivedAt < pendingPing_) {
+        return false;
+    }
+    pendingPing_ = 0;
+
+    Sample sample;
+    sample.rttUs = receivedAt - pong.clockTime;
+    sample.offsetUs = static_cast<int64_t>(pong.presentAt) -
+                      static_cast<int64_t>(pong.clockTime + sample.rttUs / 2);
+    samples_[sampleCount_ % WINDOW] = sample;
+    sampleCount_++;
+
+    size_t count = std::min(sampleCount_, WINDOW);
+    best_ = *std::min_element(samples_, samples_ + count,
+                              [](const Sample& a, const Sample& b) { return a.rttUs < b.rttUs; });
+    return true;
+}
+
+bool ClockSync::isSynced() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sampleCount_ > 0;
+}
+
+size_t ClockSync::getSampleCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sampleCount_;
+}
+
+int64_t ClockSync::getOffsetUs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return best_.offsetUs;
+}
+
+uint64_t ClockSync::getRttUs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return best_.rttUs;
+}
+
+} // namespace LiveText
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "TextMessage.h"
+
+namespace LiveText {
+
+// Estimates how far the sender's clock is from this machine's, from
+// CLOCK_PING/CLOCK_PONG round trips over the existing feeds.
+//
+// The pong carries one sender timestamp, so a sample's offset is
+// senderTime - (pingSent + pongReceived) / 2. That is exact when both legs
+// take equally long and off by at most half the round trip otherwise, so
+// of the last WINDOW samples the one with the shortest round trip wins: a
+// sample delayed by a busy network or a descheduled thread simply loses to
+// a cleaner one, and the estimate's error bound is half that round trip.
+//
+// makePing() and onPong() may be called from different threads.
+class ClockSync {
+public:
+    static constexpr size_t WINDOW = 16;
+
+    // Microseconds on this machine's monotonic clock - the sender stamps with it too
+    static uint64_t now();
+
+    ClockSync();
+
+    uint32_t getPeerId() const { return peerId_; }
+
+    // Stamped now; replaces any ping still unanswered
+    TextMessage makePing();
+
+    // A CLOCK_PONG from the sender: true if it answered our latest ping
+    bool onPong(const TextMessage& pong, uint64_t receivedAt = now());
+
+    bool isSynced() const;
+    size_t getSampleCount() const;
+    int64_t getOffsetUs() const;    // Sender clock minus ours
+    uint64_t getRttUs() const;      // Round trip of the sample in use
+
+    uint64_t toLocal(uint64_t senderTime) const { return senderTime - getOffsetUs(); }
+    uint64_t toSender(uint64_t localTime) const { return localTime + getOffsetUs(); }
+
+private:
+    struct Sample {
+        int64_t offsetUs;
+        uint64_t rttUs;
+    };
+
+    mutable std::mutex mutex_;
+    uint32_t peerId_;
+    uint64_t pendingPing_;      // When the unanswered ping was sent, 0 if none
+    Sample samples_[WINDOW];
+    size_t sampleCount_;        // All samples so far - the newest is at (sampleCount_ - 1) % WINDOW
+    Sample best_;               // Shortest round trip in the window
+};
+
+} // namespace LiveText
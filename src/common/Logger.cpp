@@ -0,0 +1,384 @@
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+namespace LiveText {
+
+// Releases the thread's ring for reuse when the thread exits
+struct ThreadRingHandle {
+    Logger::Ring* ring = nullptr;
+
+    ~ThreadRingHandle() {
+        if (ring) {
+            ring->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+namespace {
+
+thread_local ThreadRingHandle t_ringHandle;
+
+constexpr auto IDLE_INTERVAL = std::chrono::milliseconds(5);
+
+const char* levelName(uint8_t level) {
+    switch (static_cast<LogLevel>(level)) {
+        case LogLevel::TRACE: return "TRACE";
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO: return "INFO ";
+        case LogLevel::WARNING: return "WARN ";
+        case LogLevel::CRITICAL: return "CRIT ";
+    }
+    return "?    ";
+}
+
+bool parseLevel(const char* text, LogLevel& level) {
+    std::string value(text);
+    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+    if (value == "trace") level = LogLevel::TRACE;
+    else if (value == "debug") level = LogLevel::DEBUG;
+    else if (value == "info") level = LogLevel::INFO;
+    else if (value == "warning" || value == "warn") level = LogLevel::WARNING;
+    else if (value == "critical" || value == "error") level = LogLevel::CRITICAL;
+    else return false;
+    return true;
+}
+
+// Format one printf conversion against a decoded argument, ignoring the
+// format's length modifiers since every integer was stored as 64 bits
+void appendArgument(std::string& out, std::string spec, char conversion,
+                    Logger::ArgTag tag, const char* value, uint16_t stringLength) {
+    // Keep flags, width and precision; drop length modifiers
+    spec.erase(std::remove_if(spec.begin(), spec.end(), [](char c) {
+        return c == 'h' || c == 'l' || c == 'z' || c == 'j' || c == 't' || c == 'L' || c == 'q';
+    }), spec.end());
+
+    char buffer[128];
+    int written = 0;
+    switch (tag) {
+        case Logger::ARG_INT:
+        case Logger::ARG_UINT: {
+            int64_t signedValue;
+            std::memcpy(&signedValue, value, sizeof(signedValue));
+            if (conversion == 'c') {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + "c").c_str(), static_cast<int>(signedValue));
+            } else if (std::strchr("fFeEgGaA", conversion)) {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(),
+                                        static_cast<double>(signedValue));
+            } else if (std::strchr("diuxXo", conversion)) {
+                char effective = conversion;
+                if (tag == Logger::ARG_INT && (conversion == 'u')) effective = 'd';
+                if (tag == Logger::ARG_UINT && (conversion == 'd' || conversion == 'i')) effective = 'u';
+                written = std::snprintf(buffer, sizeof(buffer), (spec + "ll" + effective).c_str(), signedValue);
+            } else {
+                written = tag == Logger::ARG_INT
+                    ? std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(signedValue))
+                    : std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(signedValue));
+            }
+            break;
+        }
+        case Logger::ARG_DOUBLE: {
+            double doubleValue;
+            std::memcpy(&doubleValue, value, sizeof(doubleValue));
+            if (std::strchr("fFeEgGaA", conversion)) {
+                written = std::snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), doubleValue);
+            } else {
+                written = std::snprintf(buffer, sizeof(buffer), "%g", doubleValue);
+            }
+            break;
+        }
+        case Logger::ARG_POINTER: {
+            uint64_t pointerValue;
+            std::memcpy(&pointerValue, value, sizeof(pointerValue));
+            written = std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(pointerValue));
+            break;
+        }
+        case Logger::ARG_STRING:
+            if (spec.size() > 1) {
+                // Width/precision given - format through a terminated copy
+                std::string text(value, stringLength);
+                std::vector<char> formatted(stringLength + 256);
+                int length = std::snprintf(formatted.data(), formatted.size(), (spec + "s").c_str(), text.c_str());
+                if (length > 0) {
+                    out.append(formatted.data(), std::min(static_cast<size_t>(length), formatted.size() - 1));
+                }
+            } else {
+                out.append(value, stringLength);
+            }
+            return;
+    }
+    if (written > 0) {
+        out.append(buffer, std::min(static_cast<size_t>(written), sizeof(buffer) - 1));
+    }
+}
+
+} // namespace
+
+Logger& Logger::instance() {
+    // Never destroyed: threads may still log while statics are torn down.
+    // shutdown() (or the atexit hook) flushes what is queued.
+    static Logger* logger = new Logger();
+    return *logger;
+}
+
+Logger::Logger()
+    : level_(static_cast<uint8_t>(LogLevel::INFO))
+    , running_(false)
+    , started_(false)
+    , stopped_(false)
+{
+    LogLevel level;
+    const char* environment = std::getenv("LIVETEXT_LOG");
+    if (environment && parseLevel(environment, level)) {
+        setLevel(level);
+    }
+}
+
+Logger::~Logger() {
+    shutdown();
+}
+
+void Logger::setThreadName(const char* name) {
+    Ring* ring = threadRing();
+    std::lock_guard<std::mutex> lock(ring->nameMutex);
+    ring->name = name;
+}
+
+Logger::Ring* Logger::threadRing() {
+    if (!t_ringHandle.ring) {
+        t_ringHandle.ring = acquireRing();
+        ensureStarted();
+    }
+    return t_ringHandle.ring;
+}
+
+Logger::Ring* Logger::acquireRing() {
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+
+    // Reuse a ring from an exited thread once the formatter has emptied it
+    for (auto& ring : rings_) {
+        if (!ring->owned.load(std::memory_order_acquire) &&
+            ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_acquire)) {
+            ring->owned.store(true, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> nameLock(ring->nameMutex);
+            ring->name.clear();
+            return ring.get();
+        }
+    }
+
+    auto ring = std::make_unique<Ring>();
+    ring->id = static_cast<int>(rings_.size());
+    ring->records.reset(new char[RECORD_SIZE * RING_RECORDS]);
+    rings_.push_back(std::move(ring));
+    return rings_.back().get();
+}
+
+void Logger::ensureStarted() {
+    if (started_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(threadMutex_);
+    if (started_.load(std::memory_order_relaxed) || stopped_) {
+        return;
+    }
+
+    static bool exitHookRegistered = false;
+    if (!exitHookRegistered) {
+        std::atexit([] { Logger::instance().shutdown(); });
+        exitHookRegistered = true;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&Logger::threadMain, this);
+    started_.store(true, std::memory_order_release);
+}
+
+void Logger::shutdown() {
+    std::unique_lock<std::mutex> lock(threadMutex_);
+    stopped_ = true;
+    if (!started_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    running_ = false;
+    wakeCondition_.notify_all();
+    std::thread thread = std::move(thread_);
+    lock.unlock();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+
+    lock.lock();
+    started_.store(false, std::memory_order_release);
+}
+
+uint64_t Logger::getDroppedCount() const {
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    uint64_t dropped = 0;
+    for (const auto& ring : rings_) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void Logger::threadMain() {
+    std::string stdoutBuffer;
+    std::string stderrBuffer;
+
+    while (running_) {
+        if (!drain(stdoutBuffer, stderrBuffer)) {
+            // Producers never signal (that would cost them a lock) - poll instead
+            std::unique_lock<std::mutex> lock(threadMutex_);
+            wakeCondition_.wait_for(lock, IDLE_INTERVAL, [this] { return !running_; });
+        }
+    }
+
+    // Final flush
+    while (drain(stdoutBuffer, stderrBuffer)) {
+    }
+}
+
+bool Logger::drain(std::string& stdoutBuffer, std::string& stderrBuffer) {
+    std::vector<Ring*> rings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings.reserve(rings_.size());
+        for (auto& ring : rings_) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    // Gather everything available, then order across threads by timestamp
+    struct Pending {
+        int64_t timestampNs;
+        uint8_t level;
+        std::string line;
+    };
+    std::vector<Pending> pending;
+
+    for (Ring* ring : rings) {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            const char* record = ring->records.get() + (tail % RING_RECORDS) * RECORD_SIZE;
+            RecordHeader header;
+            std::memcpy(&header, record, sizeof(header));
+
+            Pending entry;
+            entry.timestampNs = header.timestampNs;
+            entry.level = header.level;
+            formatRecord(*ring, record, entry.line);
+            pending.push_back(std::move(entry));
+        }
+        ring->tail.store(tail, std::memory_order_release);
+
+        uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped != ring->droppedReported) {
+            Pending entry;
+            entry.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            entry.level = static_cast<uint8_t>(LogLevel::WARNING);
+            entry.line = "[logger] " + std::to_string(dropped - ring->droppedReported) +
+                         " records dropped on thread " + std::to_string(ring->id) + " (ring full)\n";
+            pending.push_back(std::move(entry));
+            ring->droppedReported = dropped;
+        }
+    }
+
+    if (pending.empty()) {
+        return false;
+    }
+
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.timestampNs < b.timestampNs;
+    });
+
+    stdoutBuffer.clear();
+    stderrBuffer.clear();
+    for (const auto& entry : pending) {
+        std::string& buffer = entry.level >= static_cast<uint8_t>(LogLevel::WARNING) ? stderrBuffer : stdoutBuffer;
+        buffer += entry.line;
+    }
+    if (!stdoutBuffer.empty()) {
+        std::fwrite(stdoutBuffer.data(), 1, stdoutBuffer.size(), stdout);
+        std::fflush(stdout);
+    }
+    if (!stderrBuffer.empty()) {
+        std::fwrite(stderrBuffer.data(), 1, stderrBuffer.size(), stderr);
+        std::fflush(stderr);
+    }
+    return true;
+}
+
+void Logger::formatRecord(const Ring& ring, const char* record, std::string& out) {
+    RecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+
+    // "HH:MM:SS.mmm LEVEL [thread] message"
+    std::time_t seconds = static_cast<std::time_t>(header.timestampNs / 1000000000);
+    int millis = static_cast<int>((header.timestampNs / 1000000) % 1000);
+    std::tm local{};
+#ifdef _WIN32
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+    char prefix[64];
+    std::snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%03d %s ",
+                  local.tm_hour, local.tm_min, local.tm_sec, millis, levelName(header.level));
+    out = prefix;
+    {
+        std::lock_guard<std::mutex> lock(ring.nameMutex);
+        out += "[" + (ring.name.empty() ? "t" + std::to_string(ring.id) : ring.name) + "] ";
+    }
+
+    const char* payload = record + sizeof(RecordHeader);
+    const char* payloadEnd = payload + header.payloadSize;
+    for (const char* f = header.format; *f; ++f) {
+        if (*f != '%') {
+            out += *f;
+            continue;
+        }
+        if (f[1] == '%') {
+            out += '%';
+            ++f;
+            continue;
+        }
+
+        // Collect the conversion spec up to its conversion character
+        std::string spec = "%";
+        const char* c = f + 1;
+        while (*c && std::strchr("-+ #0123456789.hlzjtLq", *c)) {
+            spec += *c++;
+        }
+        if (!*c) {
+            break;
+        }
+        char conversion = *c;
+        f = c;
+
+        if (payload >= payloadEnd) {
+            out += header.truncated ? "..." : "<missing>";
+            continue;
+        }
+        Logger::ArgTag tag = static_cast<Logger::ArgTag>(*payload++);
+        uint16_t stringLength = 0;
+        if (tag == Logger::ARG_STRING) {
+            std::memcpy(&stringLength, payload, sizeof(stringLength));
+            payload += sizeof(stringLength);
+            appendArgument(out, spec, conversion, tag, payload, stringLength);
+            payload += stringLength;
+        } else {
+            appendArgument(out, spec, conversion, tag, payload, 0);
+            payload += 8;
+        }
+    }
+    if (header.truncated) {
+        out += " [truncated]";
+    }
+    out += '\n';
+}
+
+} // namespace LiveText
@@ -0,0 +1,249 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Compile-time floor: calls below it compile to nothing. Release builds (NDEBUG)
+// keep INFO and above; define LIVETEXT_LOG_MIN_LEVEL to override (0 = TRACE).
+#ifndef LIVETEXT_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LIVETEXT_LOG_MIN_LEVEL 2
+#else
+#define LIVETEXT_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+namespace LiveText {
+
+enum class LogLevel : uint8_t {
+    TRACE = 0,      // Per-frame detail
+    DEBUG = 1,      // Per-message detail
+    INFO = 2,
+    WARNING = 3,
+    CRITICAL = 4
+};
+
+// Asynchronous leveled logger. Each producing thread owns a lock-free SPSC ring
+// of fixed-size binary records: the format string pointer, a timestamp and the
+// arguments packed by type. A background thread decodes, formats and writes
+// them, so a log call costs a few memcpys and never touches the terminal.
+//
+// Formats use printf conversions (%d, %u, %zu, %.2f, %s, ...); length modifiers
+// are ignored because arguments are stored as 64-bit values. The format must be
+// a string literal - only its pointer is recorded. If a ring is full the record
+// is dropped and counted rather than blocking the caller.
+//
+// Runtime level defaults to INFO; LIVETEXT_LOG=trace|debug|info|warning|critical
+// in the environment overrides it.
+class Logger {
+public:
+    static constexpr size_t RECORD_SIZE = 512;
+    static constexpr size_t RING_RECORDS = 512;   // Per thread - 256 KB
+
+    static Logger& instance();
+
+    void setLevel(LogLevel level) { level_.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+    LogLevel getLevel() const { return static_cast<LogLevel>(level_.load(std::memory_order_relaxed)); }
+    bool isEnabled(LogLevel level) const {
+        return static_cast<uint8_t>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    // Label the calling thread's records, e.g. "render"
+    void setThreadName(const char* name);
+
+    template <typename... Args>
+    void log(LogLevel level, const char* format, const Args&... args);
+
+    // Write everything queued so far and stop the background thread.
+    // Records logged afterwards are queued but no longer written.
+    void shutdown();
+
+    uint64_t getDroppedCount() const;
+
+private:
+    struct RecordHeader {
+        int64_t timestampNs;    // system_clock
+        const char* format;
+        uint16_t payloadSize;
+        uint8_t level;
+        uint8_t truncated;
+    };
+
+    struct Ring {
+        alignas(64) std::atomic<uint64_t> head{0};  // Written by the owning thread
+        alignas(64) std::atomic<uint64_t> tail{0};  // Written by the formatter
+        std::atomic<uint64_t> dropped{0};
+        uint64_t droppedReported = 0;               // Formatter only
+        std::atomic<bool> owned{true};
+        int id = 0;
+        std::string name;
+        mutable std::mutex nameMutex;
+        std::unique_ptr<char[]> records;
+    };
+
+    Logger();
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    std::atomic<uint8_t> level_;
+
+    mutable std::mutex ringsMutex_;  // Guards registration only - never taken when logging
+    std::vector<std::unique_ptr<Ring>> rings_;
+
+    std::thread thread_;
+    std::mutex threadMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<bool> running_;
+    std::atomic<bool> started_;
+    bool stopped_;              // Shut down for good - guarded by threadMutex_
+
+    Ring* threadRing();
+    Ring* acquireRing();
+    void ensureStarted();
+    void threadMain();
+    bool drain(std::string& stdoutBuffer, std::string& stderrBuffer);
+    static void formatRecord(const Ring& ring, const char* record, std::string& out);
+
+    friend struct ThreadRingHandle;
+
+public:
+    // Argument encoding - public for the templates below, not for callers
+    enum ArgTag : uint8_t { ARG_INT, ARG_UINT, ARG_DOUBLE, ARG_STRING, ARG_POINTER };
+
+    struct Encoder {
+        char* pos;
+        char* end;
+        bool truncated;
+
+        void putTagged(ArgTag tag, const void* value, size_t size) {
+            if (static_cast<size_t>(end - pos) < 1 + size) {
+                truncated = true;
+                return;
+            }
+            *pos++ = static_cast<char>(tag);
+            std::memcpy(pos, value, size);
+            pos += size;
+        }
+
+        void putString(const char* text, size_t length) {
+            if (end - pos < 3) {
+                truncated = true;
+                return;
+            }
+            size_t room = static_cast<size_t>(end - pos) - 3;
+            if (length > room) {
+                length = room;
+                truncated = true;
+            }
+            uint16_t stored = static_cast<uint16_t>(length);
+            *pos++ = static_cast<char>(ARG_STRING);
+            std::memcpy(pos, &stored, sizeof(stored));
+            pos += sizeof(stored);
+            std::memcpy(pos, text, length);
+            pos += length;
+        }
+
+        template <typename T>
+        void put(const T& value) {
+            using U = std::decay_t<T>;
+            if constexpr (std::is_array_v<T>) {
+                putString(value, std::strlen(value));
+            } else if constexpr (std::is_same_v<U, bool>) {
+                int64_t v = value ? 1 : 0;
+                putTagged(ARG_INT, &v, sizeof(v));
+            } else if constexpr (std::is_enum_v<U>) {
+                int64_t v = static_cast<int64_t>(value);
+                putTagged(ARG_INT, &v, sizeof(v));
+            } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+                int64_t v = value;
+                putTagged(ARG_INT, &v, sizeof(v));
+            } else if constexpr (std::is_integral_v<U>) {
+                uint64_t v = value;
+                putTagged(ARG_UINT, &v, sizeof(v));
+            } else if constexpr (std::is_floating_point_v<U>) {
+                double v = value;
+                putTagged(ARG_DOUBLE, &v, sizeof(v));
+            } else if constexpr (std::is_same_v<U, std::string>) {
+                putString(value.data(), value.size());
+            } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+                putString(value ? value : "(null)", value ? std::strlen(value) : 6);
+            } else if constexpr (std::is_pointer_v<U>) {
+                uint64_t v = reinterpret_cast<uintptr_t>(value);
+                putTagged(ARG_POINTER, &v, sizeof(v));
+            } else {
+                static_assert(std::is_arithmetic_v<U>, "Unsupported log argument type");
+            }
+        }
+    };
+};
+
+template <typename... Args>
+void Logger::log(LogLevel level, const char* format, const Args&... args) {
+    Ring* ring = threadRing();
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= RING_RECORDS) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    char* record = ring->records.get() + (head % RING_RECORDS) * RECORD_SIZE;
+    RecordHeader header;
+    header.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.format = format;
+    header.level = static_cast<uint8_t>(level);
+
+    Encoder encoder{record + sizeof(RecordHeader), record + RECORD_SIZE, false};
+    (encoder.put(args), ...);
+    header.payloadSize = static_cast<uint16_t>(encoder.pos - (record + sizeof(RecordHeader)));
+    header.truncated = encoder.truncated ? 1 : 0;
+    std::memcpy(record, &header, sizeof(header));
+
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+// Never defined: names a compiled-out log call's arguments without evaluating them
+template <typename... Args>
+int discardLogArgs(const Args&... args);
+
+} // namespace LiveText
+
+#define LT_LOG(level, ...) \
+    do { \
+        if (::LiveText::Logger::instance().isEnabled(level)) { \
+            ::LiveText::Logger::instance().log(level, __VA_ARGS__); \
+        } \
+    } while (0)
+
+// Arguments are still named, unevaluated, so a variable only logged is not unused
+#define LT_LOG_DISABLED(...) do { (void)sizeof(::LiveText::discardLogArgs(__VA_ARGS__)); } while (0)
+
+#if LIVETEXT_LOG_MIN_LEVEL <= 0
+#define LT_LOG_TRACE(...) LT_LOG(::LiveText::LogLevel::TRACE, __VA_ARGS__)
+#else
+#define LT_LOG_TRACE(...) LT_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if LIVETEXT_LOG_MIN_LEVEL <= 1
+#define LT_LOG_DEBUG(...) LT_LOG(::LiveText::LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define LT_LOG_DEBUG(...) LT_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if LIVETEXT_LOG_MIN_LEVEL <= 2
+#define LT_LOG_INFO(...) LT_LOG(::LiveText::LogLevel::INFO, __VA_ARGS__)
+#else
+#define LT_LOG_INFO(...) LT_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#define LT_LOG_WARNING(...) LT_LOG(::LiveText::LogLevel::WARNING, __VA_ARGS__)
+#define LT_LOG_CRITICAL(...) LT_LOG(::LiveText::LogLevel::CRITICAL, __VA_ARGS__)
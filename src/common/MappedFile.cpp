@@ -0,0 +1,221 @@
+#include "MappedFile.h"
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LiveText {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile()
+    : data_(nullptr)
+    , size_(0)
+    , writable_(false)
+    , file_(INVALID_HANDLE_VALUE)
+    , mapping_(nullptr)
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::openRead(const std::string& path) {
+    close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+    data_ = view;
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    path_ = path;
+    return true;
+}
+
+bool MappedFile::openReadWrite(const std::string& path, size_t size) {
+    close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE || size == 0) {
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+        return false;
+    }
+
+    // Mapping a size also sets the file to that size
+    LARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = static_cast<LONGLONG>(size);
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > mappingSize.QuadPart) {
+        SetFilePointerEx(file, mappingSize, nullptr, FILE_BEGIN);
+        SetEndOfFile(file);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                        mappingSize.HighPart, mappingSize.LowPart, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+    data_ = view;
+    size_ = size;
+    path_ = path;
+    writable_ = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+    if (mapping_) {
+        CloseHandle(static_cast<HANDLE>(mapping_));
+        mapping_ = nullptr;
+    }
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(static_cast<HANDLE>(file_));
+        file_ = INVALID_HANDLE_VALUE;
+    }
+    size_ = 0;
+    path_.clear();
+    writable_ = false;
+}
+
+#else
+
+MappedFile::MappedFile()
+    : data_(nullptr)
+    , size_(0)
+    , writable_(false)
+    , fd_(-1)
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::openRead(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        std::cerr << "Failed to map " << path << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+    data_ = data;
+    size_ = static_cast<size_t>(info.st_size);
+    path_ = path;
+    return true;
+}
+
+bool MappedFile::openReadWrite(const std::string& path, size_t size) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0 || size == 0) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return false;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "Failed to size " << path << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        std::cerr << "Failed to map " << path << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+    data_ = data;
+    size_ = size;
+    path_ = path;
+    writable_ = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_) {
+        munmap(data_, size_);
+        data_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    size_ = 0;
+    path_.clear();
+    writable_ = false;
+}
+
+#endif
+
+} // namespace LiveText
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace LiveText {
+
+// Memory mapping of a whole file. The pages are faulted in on first access,
+// so opening a large cache or show file costs almost nothing until the data
+// is used. openReadWrite() maps a small state file shared with the disk:
+// stores through mutableData() reach the page cache with no system call and
+// survive the process crashing.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool openRead(const std::string& path);
+
+    // Creates the file if needed and sizes it to exactly size bytes; new bytes read as zero
+    bool openReadWrite(const std::string& path, size_t size);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    bool isWritable() const { return writable_; }
+    const uint8_t* data() const { return static_cast<const uint8_t*>(data_); }
+    uint8_t* mutableData() { return writable_ ? static_cast<uint8_t*>(data_) : nullptr; }
+    size_t size() const { return size_; }
+    const std::string& path() const { return path_; }
+
+private:
+    void* data_;
+    size_t size_;
+    std::string path_;
+    bool writable_;
+
+#ifdef _WIN32
+    void* file_;
+    void* mapping_;
+#else
+    int fd_;
+#endif
+};
+
+} // namespace LiveText
@@ -0,0 +1,204 @@
+#include "ShmFrameClient.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace LiveText {
+
+ShmFrameClient::ShmFrameClient()
+    : fd_(-1)
+    , mapping_(nullptr)
+    , mappingSize_(0)
+    , header_(nullptr)
+    , slotData_(nullptr)
+    , lastFrameCounter_(0)
+    , tornReads_(0)
+{
+}
+
+ShmFrameClient::~ShmFrameClient() {
+    close();
+}
+
+#ifdef __linux__
+
+bool ShmFrameClient::open(const std::string& senderName) {
+    close();
+
+    std::string name = ShmFrame::segmentName(senderName);
+    fd_ = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < ShmFrame::headerSize()) {
+        close();
+        return false;
+    }
+    mappingSize_ = static_cast<size_t>(st.st_size);
+
+    mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        close();
+        return false;
+    }
+
+    auto* header = static_cast<const ShmFrame::RingHeader*>(mapping_);
+    if (header->magic != ShmFrame::MAGIC) {
+        close();
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (header->version != ShmFrame::VERSION) {
+        std::cerr << "Shared memory segment " << name << " has version " << header->version
+                  << ", expected " << ShmFrame::VERSION << std::endl;
+        close();
+        return false;
+    }
+    if (header->dataOffset + header->slotSize * header->slotCount > mappingSize_) {
+        std::cerr << "Shared memory segment " << name << " is truncated" << std::endl;
+        close();
+        return false;
+    }
+
+    header_ = header;
+    slotData_ = static_cast<const uint8_t*>(mapping_) + header_->dataOffset;
+    lastFrameCounter_ = 0;
+    tornReads_ = 0;
+    return true;
+}
+
+void ShmFrameClient::close() {
+    header_ = nullptr;
+    slotData_ = nullptr;
+    if (mapping_) {
+        munmap(mapping_, mappingSize_);
+        mapping_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool ShmFrameClient::isWriterAlive() const {
+    return header_ && header_->magic == ShmFrame::MAGIC;
+}
+
+bool ShmFrameClient::waitForFrame(int timeoutMs) {
+    if (!header_) {
+        return false;
+    }
+
+    // Absolute deadline so spurious wakeups don't extend the wait
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t deadlineNs = static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec
+                       + static_cast<int64_t>(timeoutMs) * 1000000LL;
+
+    auto* futexWord = const_cast<std::atomic<uint32_t>*>(&header_->futexWord);
+    while (true) {
+        uint32_t observed = futexWord->load(std::memory_order_acquire);
+        if (!isWriterAlive()) {
+            return false;
+        }
+        if (header_->latestFrame.load(std::memory_order_acquire) > lastFrameCounter_) {
+            return true;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t remainingNs = deadlineNs - (static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec);
+        if (remainingNs <= 0) {
+            return false;
+        }
+        struct timespec timeout;
+        timeout.tv_sec = remainingNs / 1000000000LL;
+        timeout.tv_nsec = remainingNs % 1000000000LL;
+
+        // Returns immediately if the writer bumped the word since we loaded it
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(futexWord),
+                FUTEX_WAIT, observed, &timeout, nullptr, 0);
+    }
+}
+
+bool ShmFrameClient::readLatest(std::vector<uint8_t>& pixels, ShmFrameInfo& info) {
+    if (!header_ || header_->latestFrame.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    uint32_t slotIndex = header_->latestSlot.load(std::memory_order_acquire);
+    if (slotIndex >= header_->slotCount) {
+        return false;
+    }
+    const ShmFrame::SlotHeader& slot = header_->slots[slotIndex];
+
+    // Seqlock read: retry is pointless (the slot is being rewritten), so report torn
+    uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+        tornReads_++;
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(slot.size);
+    if (size > header_->slotSize) {
+        tornReads_++;
+        return false;
+    }
+    pixels.resize(size);
+    std::memcpy(pixels.data(), slotData_ + slotIndex * header_->slotSize, size);
+    info.frameCounter = slot.frameCounter;
+    info.timestampUs = slot.timestampUs;
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+    if (before != after) {
+        tornReads_++;
+        return false;
+    }
+
+    info.width = header_->width;
+    info.height = header_->height;
+    info.stride = header_->stride;
+    info.format = header_->format;
+    info.bottomUp = (header_->flags & ShmFrame::FLAG_BOTTOM_UP) != 0;
+    lastFrameCounter_ = info.frameCounter;
+    return true;
+}
+
+#else
+
+bool ShmFrameClient::open(const std::string&) {
+    std::cerr << "Shared memory frame client is only available on Linux" << std::endl;
+    return false;
+}
+
+void ShmFrameClient::close() {
+}
+
+bool ShmFrameClient::isWriterAlive() const {
+    return false;
+}
+
+bool ShmFrameClient::waitForFrame(int) {
+    return false;
+}
+
+bool ShmFrameClient::readLatest(std::vector<uint8_t>&, ShmFrameInfo&) {
+    return false;
+}
+
+#endif
+
+} // namespace LiveText
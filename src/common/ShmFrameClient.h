@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ShmFrameRing.h"
+
+namespace LiveText {
+
+struct ShmFrameInfo {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t stride = 0;
+    ShmFrame::PixelFormat format = ShmFrame::PixelFormat::RGBA8;
+    bool bottomUp = true;
+    uint64_t frameCounter = 0;
+    uint64_t timestampUs = 0;   // CLOCK_MONOTONIC microseconds when the frame was rendered
+};
+
+// Reads frames published by a LiveText receiver's ShmFrameServer.
+// Linux only - open() fails elsewhere.
+class ShmFrameClient {
+public:
+    ShmFrameClient();
+    ~ShmFrameClient();
+
+    ShmFrameClient(const ShmFrameClient&) = delete;
+    ShmFrameClient& operator=(const ShmFrameClient&) = delete;
+
+    // senderName is the TextureSender name, e.g. "LiveText-Small"
+    bool open(const std::string& senderName);
+    void close();
+    bool isOpen() const { return header_ != nullptr; }
+
+    // False once the server has shut down or restarted - reopen to continue
+    bool isWriterAlive() const;
+
+    // Sleeps until a frame newer than the last one read is available.
+    // Returns false on timeout or if the writer went away.
+    bool waitForFrame(int timeoutMs);
+
+    // Copies the newest frame into pixels. Returns false if there is no frame
+    // yet or the writer lapped us mid-copy (counted in getTornReads()).
+    bool readLatest(std::vector<uint8_t>& pixels, ShmFrameInfo& info);
+
+    uint64_t getLastFrameCounter() const { return lastFrameCounter_; }
+    uint64_t getTornReads() const { return tornReads_; }
+
+private:
+    int fd_;
+    void* mapping_;
+    size_t mappingSize_;
+    const ShmFrame::RingHeader* header_;
+    const uint8_t* slotData_;
+    uint64_t lastFrameCounter_;
+    uint64_t tornReads_;
+};
+
+} // namespace LiveText
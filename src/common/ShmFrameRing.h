@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace LiveText {
+
+// Memory layout shared between ShmFrameServer (receiver) and ShmFrameClient.
+// The segment lives at /dev/shm/<sender name> and holds a small header followed
+// by SLOT_COUNT frame slots. Each slot is guarded by a seqlock; the header's
+// futexWord is bumped after every published frame so clients can sleep on it.
+namespace ShmFrame {
+
+constexpr uint32_t MAGIC = 0x4C54464D;  // 'LTFM'
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t SLOT_COUNT = 3;
+constexpr size_t DATA_ALIGNMENT = 4096;
+
+enum class PixelFormat : uint32_t {
+    RGBA8 = 1
+};
+
+enum Flags : uint32_t {
+    FLAG_BOTTOM_UP = 1u << 0  // First row in memory is the bottom of the image (OpenGL order)
+};
+
+struct alignas(64) SlotHeader {
+    std::atomic<uint64_t> sequence;  // Seqlock - odd while the slot is being written
+    uint64_t frameCounter;           // Publisher frame number stored in this slot
+    uint64_t timestampUs;            // CLOCK_MONOTONIC time the frame was rendered
+    uint64_t size;                   // Valid bytes in the slot
+};
+
+struct alignas(64) RingHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+    PixelFormat format;
+    uint32_t flags;
+    uint32_t slotCount;
+    uint64_t slotSize;     // Bytes reserved per slot (page aligned)
+    uint64_t dataOffset;   // Offset of slot 0 from the start of the mapping
+    uint32_t writerPid;
+    uint32_t reserved;
+
+    std::atomic<uint64_t> latestFrame;  // frameCounter of the newest complete slot (0 = none yet)
+    std::atomic<uint32_t> latestSlot;   // Index of that slot
+    std::atomic<uint32_t> futexWord;    // Incremented after every frame - futex wait/wake target
+
+    SlotHeader slots[SLOT_COUNT];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared-memory atomics must be lock free");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared-memory atomics must be lock free");
+
+inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+inline size_t headerSize() {
+    return alignUp(sizeof(RingHeader), DATA_ALIGNMENT);
+}
+
+inline size_t slotSize(uint32_t stride, uint32_t height) {
+    return alignUp(static_cast<size_t>(stride) * height, DATA_ALIGNMENT);
+}
+
+inline size_t mappingSize(uint32_t stride, uint32_t height) {
+    return headerSize() + slotSize(stride, height) * SLOT_COUNT;
+}
+
+// POSIX shm object name for a texture sender, e.g. "LiveText-Small" -> "/LiveText-Small"
+inline std::string segmentName(const std::string& senderName) {
+    return "/" + senderName;
+}
+
+} // namespace ShmFrame
+
+} // namespace LiveText
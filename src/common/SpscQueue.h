@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace LiveText {
+
+// Bounded lock-free single-producer/single-consumer queue.
+// The producer calls tryPush(), the consumer front() and pop(); neither ever
+// waits, and a full queue is reported rather than blocking the producer.
+// Slots are reused in place, so T is copied in and read where it lies.
+// Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : head_(0), tail_(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer side - false if the queue is full
+    bool tryPush(const T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots_[tail & (Capacity - 1)] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side - oldest entry, or nullptr if empty. Valid until pop().
+    T* front() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slots_[head & (Capacity - 1)];
+    }
+
+    void pop() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Either side - exact for the caller's own end, a snapshot of the other
+    size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    alignas(64) std::atomic<size_t> head_;     // Written by the consumer
+    alignas(64) std::atomic<size_t> tail_;     // Written by the producer
+    std::array<T, Capacity> slots_;
+};
+
+} // namespace LiveText
@@ -4,12 +4,45 @@
 
 namespace LiveText {
 
+namespace {
+
+bool isValidType(MessageType type) {
+    switch (type) {
+        case MessageType::TEXT_UPDATE:
+        case MessageType::CLEAR_TEXT:
+        case MessageType::HEARTBEAT:
+        case MessageType::FIT_REPORT:
+        case MessageType::STATE_REFRESH:
+        case MessageType::STATE_REQUEST:
+        case MessageType::CUE_PRELOAD:
+        case MessageType::CUE_GO:
+        case MessageType::CLOCK_PING:
+        case MessageType::CLOCK_PONG:
+        case MessageType::PRESENT_REPORT:
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
 TextMessage::TextMessage()
     : type(MessageType::TEXT_UPDATE)
     , size(TextSize::SMALL)
+    , fadeElapsedMs(0)
     , textLength(0)
     , timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count())
+    , fitScale(1.0f)
+    , fitLines(0)
+    , fitFlags(0)
+    , stateFlags(0)
+    , revision(0)
+    , stateHash(0)
+    , cueId(0)
+    , peerId(0)
+    , presentAt(0)
+    , clockTime(0)
 {
     memset(text, 0, sizeof(text));
 }
@@ -17,8 +50,19 @@ TextMessage::TextMessage()
 TextMessage::TextMessage(const std::string& text, TextSize size)
     : type(MessageType::TEXT_UPDATE)
     , size(size)
+    , fadeElapsedMs(0)
     , timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count())
+    , fitScale(1.0f)
+    , fitLines(0)
+    , fitFlags(0)
+    , stateFlags(0)
+    , revision(0)
+    , stateHash(0)
+    , cueId(0)
+    , peerId(0)
+    , presentAt(0)
+    , clockTime(0)
 {
     setText(text);
 }
@@ -39,6 +83,95 @@ TextMessage TextMessage::createHeartbeat() {
     return msg;
 }
 
+TextMessage TextMessage::createFitReport(const TextMessage& source, float scale, int lines, uint8_t flags) {
+    // Echo the text and its timestamp so the sender can tell which update this describes
+    TextMessage msg = source;
+    msg.type = MessageType::FIT_REPORT;
+    msg.fitScale = scale;
+    msg.fitLines = static_cast<uint16_t>(std::min(lines, 0xFFFF));
+    msg.fitFlags = flags;
+    return msg;
+}
+
+TextMessage TextMessage::createStateRefresh(const TextMessage& state, bool includeText) {
+    // Keeps the state's revision, hash and timestamp - receivers use the timestamp to
+    // tell a refresh that was overtaken by a newer update on the other feed
+    TextMessage msg = state;
+    msg.type = MessageType::STATE_REFRESH;
+    msg.stateFlags = includeText ? STATE_HAS_TEXT : 0;
+    msg.presentAt = 0;  // Repairs go up at once
+    if (!includeText) {
+        msg.textLength = 0;
+        msg.text[0] = '\0';
+    }
+    return msg;
+}
+
+TextMessage TextMessage::createStateRequest(uint32_t revision) {
+    TextMessage msg;
+    msg.type = MessageType::STATE_REQUEST;
+    msg.revision = revision;
+    return msg;
+}
+
+TextMessage TextMessage::createCuePreload(uint32_t cueId, const std::string& text, TextSize size) {
+    TextMessage msg(text, size);
+    msg.type = MessageType::CUE_PRELOAD;
+    msg.cueId = cueId;
+    return msg;
+}
+
+TextMessage TextMessage::createCueGo(uint32_t cueId, const std::string& text, TextSize size) {
+    // Only the hash travels - the receivers already have the text from the preload
+    TextMessage msg;
+    msg.type = MessageType::CUE_GO;
+    msg.size = size;
+    msg.cueId = cueId;
+    msg.stateHash = hashState(text.data(), std::min(text.size(), sizeof(msg.text) - 1), size);
+    return msg;
+}
+
+TextMessage TextMessage::createClockPing(uint32_t peerId, uint64_t localTime) {
+    TextMessage msg;
+    msg.type = MessageType::CLOCK_PING;
+    msg.peerId = peerId;
+    msg.clockTime = localTime;
+    return msg;
+}
+
+TextMessage TextMessage::createClockPong(const TextMessage& ping, uint64_t senderTime) {
+    // Echo the ping so the receiver can match it and knows when it sent it
+    TextMessage msg;
+    msg.type = MessageType::CLOCK_PONG;
+    msg.peerId = ping.peerId;
+    msg.clockTime = ping.clockTime;
+    msg.presentAt = senderTime;
+    return msg;
+}
+
+TextMessage TextMessage::createPresentReport(uint32_t peerId, uint32_t revision, uint64_t presentAt, uint64_t shownAt) {
+    TextMessage msg;
+    msg.type = MessageType::PRESENT_REPORT;
+    msg.peerId = peerId;
+    msg.revision = revision;
+    msg.presentAt = presentAt;
+    msg.clockTime = shownAt;
+    return msg;
+}
+
+uint32_t TextMessage::hashState(const char* text, size_t length, TextSize size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+    }
+
+    // Size only matters while something is shown - a cleared screen is a cleared screen
+    if (length > 0) {
+        hash = (hash ^ static_cast<uint8_t>(size)) * 16777619u;
+    }
+    return hash;
+}
+
 std::string TextMessage::getText() const {
     return std::string(text, textLength);
 }
@@ -50,45 +183,45 @@ void TextMessage::setText(const std::string& newText) {
 }
 
 size_t TextMessage::serialize(uint8_t* buffer, size_t bufferSize) const {
-    const size_t requiredSize = sizeof(TextMessage);
-    if (bufferSize < requiredSize || buffer == nullptr) {
-        return 0;
-    }
-
     // Validate internal state before serialization
     if (textLength >= sizeof(text)) {
         return 0;  // Invalid state - prevent buffer overflow
     }
 
+    const size_t requiredSize = getSerializedSize();
+    if (bufferSize < requiredSize || buffer == nullptr) {
+        return 0;
+    }
+
     // Validate message type
-    if (type != MessageType::TEXT_UPDATE &&
-        type != MessageType::CLEAR_TEXT &&
-        type != MessageType::HEARTBEAT) {
+    if (!isValidType(type)) {
         return 0;  // Invalid message type
     }
 
-    // Safe copy with validation
+    // Header as laid out in memory, then only the text in use
     memcpy(buffer, this, requiredSize);
     return requiredSize;
 }
 
 bool TextMessage::deserialize(const uint8_t* buffer, size_t bufferSize) {
-    if (bufferSize < sizeof(TextMessage) || buffer == nullptr) {
+    if (bufferSize < getHeaderSize() || buffer == nullptr) {
         return false;
     }
 
     // Safe copy
-    memcpy(this, buffer, sizeof(TextMessage));
+    memcpy(this, buffer, getHeaderSize());
 
     // Validate and sanitize all fields
     if (textLength >= sizeof(text)) {
         textLength = sizeof(text) - 1;  // Cap at maximum safe length
     }
+    if (textLength > bufferSize - getHeaderSize()) {
+        return false;  // Truncated datagram
+    }
+    memcpy(text, buffer + getHeaderSize(), textLength);
 
     // Validate message type
-    if (type != MessageType::TEXT_UPDATE &&
-        type != MessageType::CLEAR_TEXT &&
-        type != MessageType::HEARTBEAT) {
+    if (!isValidType(type)) {
         return false;  // Invalid message type
     }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <cstddef>
 #include <cstdint>
 #include <chrono>
 
@@ -13,28 +14,77 @@ enum class TextSize : uint8_t {
 enum class MessageType : uint8_t {
     TEXT_UPDATE = 1,
     CLEAR_TEXT = 2,
-    HEARTBEAT = 3
+    HEARTBEAT = 3,
+    FIT_REPORT = 4,     // Receiver -> sender: how the echoed text was laid out
+    STATE_REFRESH = 5,  // Periodic: revision, size and stateHash, plus the text if STATE_HAS_TEXT
+    STATE_REQUEST = 6,  // Receiver -> sender: joining, or state hash mismatch - send a snapshot
+    CUE_PRELOAD = 7,    // A cue that may go next: receivers lay it out and render it ahead of time
+    CUE_GO = 8,         // Show preloaded cue cueId - no text, stateHash says what it should be
+    CLOCK_PING = 9,     // Receiver -> sender: clockTime is the receiver's clock when sent
+    CLOCK_PONG = 10,    // Sender -> receivers: the ping's peerId and clockTime, presentAt the sender's clock
+    PRESENT_REPORT = 11 // Receiver -> sender: revision shown at clockTime (sender clock), aimed at presentAt
+};
+
+// FIT_REPORT flags
+enum FitFlags : uint8_t {
+    FIT_WRAPPED = 1 << 0,   // Lines were word-wrapped to the safe area
+    FIT_SHRUNK = 1 << 1,    // Drawn below full size to fit
+    FIT_CLIPPED = 1 << 2    // Overflows the safe area even at the minimum scale
+};
+
+// STATE_REFRESH flags
+enum StateFlags : uint8_t {
+    STATE_HAS_TEXT = 1 << 0,    // text holds the full current state, not just its hash
+    STATE_FADING = 1 << 1       // Cleared, but text is still fading out, fadeElapsedMs into the fade
 };
 
 struct TextMessage {
     MessageType type;
     TextSize size;
+    uint16_t fadeElapsedMs; // STATE_REFRESH with STATE_FADING
     uint32_t textLength;
     uint64_t timestamp;
-    char text[512];  // Fixed size for efficient serialization
+    float fitScale;     // FIT_REPORT: 1.0 = full size
+    uint16_t fitLines;  // FIT_REPORT: lines after wrapping
+    uint8_t fitFlags;   // FIT_REPORT: FitFlags
+    uint8_t stateFlags; // STATE_REFRESH: StateFlags
+    uint32_t revision;  // TEXT_UPDATE, CLEAR_TEXT, STATE_REFRESH: sender's state counter
+    uint32_t stateHash; // TEXT_UPDATE, CLEAR_TEXT, STATE_REFRESH, CUE_GO: hashState() of the state after it
+    uint32_t cueId;     // CUE_PRELOAD, CUE_GO: position in the sender's show file, from 1
+    uint32_t peerId;    // CLOCK_PING, CLOCK_PONG, PRESENT_REPORT: the receiver's random id
+    uint64_t presentAt; // TEXT_UPDATE, CLEAR_TEXT, CUE_GO: sender clock (us) to show it at, 0 = on arrival
+    uint64_t clockTime; // CLOCK_PING, CLOCK_PONG, PRESENT_REPORT: see MessageType
+    char text[512];  // Fixed capacity; only textLength bytes go on the wire
 
     TextMessage();
     explicit TextMessage(const std::string& text, TextSize size = TextSize::SMALL);
     static TextMessage createClearMessage();
     static TextMessage createHeartbeat();
+    static TextMessage createFitReport(const TextMessage& source, float scale, int lines, uint8_t flags);
+    static TextMessage createStateRefresh(const TextMessage& state, bool includeText);
+    static TextMessage createStateRequest(uint32_t revision);
+    static TextMessage createCuePreload(uint32_t cueId, const std::string& text, TextSize size);
+    static TextMessage createCueGo(uint32_t cueId, const std::string& text, TextSize size);
+    static TextMessage createClockPing(uint32_t peerId, uint64_t localTime);
+    static TextMessage createClockPong(const TextMessage& ping, uint64_t senderTime);
+    static TextMessage createPresentReport(uint32_t peerId, uint32_t revision, uint64_t presentAt, uint64_t shownAt);
+
+    // Identifies what a receiver should be showing: the text and, if there is any, its size.
+    // FNV-1a - cheap enough to run on every message, not meant to resist collisions on purpose.
+    static uint32_t hashState(const char* text, size_t length, TextSize size);
+    static uint32_t hashState(const std::string& text, TextSize size) { return hashState(text.data(), text.size(), size); }
 
     std::string getText() const;
     void setText(const std::string& text);
 
-    // Serialization
+    // Serialization - the fixed header followed by textLength bytes of text
     size_t serialize(uint8_t* buffer, size_t bufferSize) const;
     bool deserialize(const uint8_t* buffer, size_t bufferSize);
+    size_t getSerializedSize() const { return getHeaderSize() + textLength; }
     static constexpr size_t getMaxSerializedSize() { return sizeof(TextMessage); }
+    static constexpr size_t getHeaderSize();
 };
 
+constexpr size_t TextMessage::getHeaderSize() { return offsetof(TextMessage, text); }
+
 } // namespace LiveText
\ No newline at end of file
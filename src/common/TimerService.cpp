@@ -0,0 +1,94 @@
+#include "TimerService.h"
+#include "Logger.h"
+#include <algorithm>
+
+namespace LiveText {
+
+TimerService& TimerService::instance() {
+    // Never destroyed, like the logger: publishers cancel their timers on
+    // shutdown, and the idle thread just waits until the process exits
+    static TimerService* service = new TimerService();
+    return *service;
+}
+
+TimerService::TimerService()
+    : started_(false)
+    , nextId_(1)
+    , firingId_(0)
+{
+}
+
+int TimerService::schedule(std::chrono::milliseconds interval, Callback callback) {
+    // run() steps a due timer forward by its interval until it is in the future
+    if (interval.count() <= 0) {
+        LT_LOG_WARNING("Timer interval must be positive (got %lld ms)", static_cast<long long>(interval.count()));
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!started_) {
+        std::thread thread(&TimerService::run, this);
+        threadId_ = thread.get_id();
+        thread.detach();
+        started_ = true;
+    }
+
+    int id = nextId_++;
+    timers_.push_back({id, interval, std::chrono::steady_clock::now() + interval, std::move(callback)});
+    wakeCondition_.notify_one();
+    return id;
+}
+
+void TimerService::cancel(int id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    timers_.erase(std::remove_if(timers_.begin(), timers_.end(),
+                                 [id](const Timer& timer) { return timer.id == id; }),
+                  timers_.end());
+
+    // Wait out a call in progress - unless this is that call
+    if (std::this_thread::get_id() != threadId_) {
+        firedCondition_.wait(lock, [this, id]() { return firingId_ != id; });
+    }
+    wakeCondition_.notify_one();
+}
+
+size_t TimerService::getTimerCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timers_.size();
+}
+
+void TimerService::run() {
+    Logger::instance().setThreadName("timer");
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        if (timers_.empty()) {
+            wakeCondition_.wait(lock);
+            continue;
+        }
+
+        auto due = std::min_element(timers_.begin(), timers_.end(),
+                                    [](const Timer& a, const Timer& b) { return a.next < b.next; });
+        auto now = std::chrono::steady_clock::now();
+        if (due->next > now) {
+            wakeCondition_.wait_until(lock, due->next);
+            continue;
+        }
+
+        // Next tick on the original grid, skipping any that were missed
+        while (due->next <= now) {
+            due->next += due->interval;
+        }
+
+        // Run unlocked so callbacks can schedule or cancel; cancel() waits on firingId_
+        Callback callback = due->callback;
+        firingId_ = due->id;
+        lock.unlock();
+        callback();
+        lock.lock();
+        firingId_ = 0;
+        firedCondition_.notify_all();
+    }
+}
+
+} // namespace LiveText
@@ -0,0 +1,55 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LiveText {
+
+// One process-wide thread running periodic callbacks, so each publisher does
+// not need a sleeping thread of its own for heartbeats and state refreshes.
+//
+// Callbacks run on the timer thread, one at a time, and should only do a
+// little bookkeeping or wake the thread that owns the real work. A callback
+// that overruns delays the others; a timer that falls behind skips the missed
+// ticks rather than firing in a burst.
+class TimerService {
+public:
+    using Callback = std::function<void()>;
+
+    static TimerService& instance();
+
+    // First call after one interval. Returns an id for cancel(), or 0 if the
+    // interval is not positive.
+    int schedule(std::chrono::milliseconds interval, Callback callback);
+
+    // Once this returns the callback is not running and will not run again.
+    // Safe to call from inside the callback itself.
+    void cancel(int id);
+
+    size_t getTimerCount() const;
+
+private:
+    struct Timer {
+        int id;
+        std::chrono::milliseconds interval;
+        std::chrono::steady_clock::time_point next;
+        Callback callback;
+    };
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeCondition_;     // Timers changed
+    std::condition_variable firedCondition_;    // A callback returned
+    std::vector<Timer> timers_;
+    std::thread::id threadId_;
+    bool started_;
+    int nextId_;
+    int firingId_;      // Callback running right now, 0 if none
+
+    TimerService();
+    void run();
+};
+
+} // namespace LiveText
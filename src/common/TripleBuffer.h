@@ -0,0 +1,54 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace LiveText {
+
+// Lock-free single-writer/single-reader handoff of the latest value.
+// The writer fills writeBuffer() and publish()es it; the reader calls
+// update() and then read()s the newest published value. Neither side ever
+// waits, and intermediate values the reader didn't get to are skipped.
+// Buffers are reused, so filling them by assignment avoids reallocation.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer()
+        : middle_(1)
+        , writeIndex_(0)
+        , readIndex_(2)
+    {}
+
+    // Writer side
+    T& writeBuffer() { return buffers_[writeIndex_]; }
+
+    // Returns true if this replaced a value the reader never picked up
+    bool publish() {
+        uint8_t previous = middle_.exchange(static_cast<uint8_t>(writeIndex_ | FRESH), std::memory_order_acq_rel);
+        writeIndex_ = previous & INDEX_MASK;
+        return (previous & FRESH) != 0;
+    }
+
+    // Reader side - returns true if a newer value was picked up
+    bool update() {
+        if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        uint8_t previous = middle_.exchange(readIndex_, std::memory_order_acq_rel);
+        readIndex_ = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& read() const { return buffers_[readIndex_]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    std::array<T, 3> buffers_;
+    std::atomic<uint8_t> middle_;  // Index of the shared buffer, FRESH if the reader hasn't taken it
+    uint8_t writeIndex_;
+    uint8_t readIndex_;
+};
+
+} // namespace LiveText
@@ -0,0 +1,131 @@
+#include "common/ShmFrameClient.h"
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Minimal consumer for the receiver's shared-memory frame server.
+// Usage: shm_consumer [sender name] [--dump file.pam]
+// Prints frame rate, latency from render to read, and dropped/torn frames
+// once a second. --dump writes the first frame received as a PAM image.
+
+namespace {
+
+volatile std::sig_atomic_t g_running = 1;
+
+void handleSignal(int) {
+    g_running = 0;
+}
+
+uint64_t steadyMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool writePam(const std::string& path, const std::vector<uint8_t>& pixels, const LiveText::ShmFrameInfo& info) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n",
+                 info.width, info.height);
+    for (uint32_t row = 0; row < info.height; ++row) {
+        uint32_t sourceRow = info.bottomUp ? info.height - 1 - row : row;
+        std::fwrite(pixels.data() + static_cast<size_t>(sourceRow) * info.stride, 1, info.width * 4, file);
+    }
+    std::fclose(file);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string senderName = "LiveText-Small";
+    std::string dumpPath;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dumpPath = argv[++i];
+        } else {
+            senderName = argv[i];
+        }
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    LiveText::ShmFrameClient client;
+    std::vector<uint8_t> pixels;
+    LiveText::ShmFrameInfo info;
+
+    uint64_t framesRead = 0;
+    uint64_t framesDropped = 0;
+    uint64_t latencySumUs = 0;
+    uint64_t maxLatencyUs = 0;
+    auto windowStart = std::chrono::steady_clock::now();
+
+    std::cout << "Waiting for shared memory frames from " << senderName << "..." << std::endl;
+
+    while (g_running) {
+        if (!client.isOpen() || !client.isWriterAlive()) {
+            client.close();
+            if (!client.open(senderName)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                continue;
+            }
+            std::cout << "Connected to /dev/shm/" << senderName << std::endl;
+        }
+
+        if (!client.waitForFrame(1000)) {
+            continue;
+        }
+
+        uint64_t previous = client.getLastFrameCounter();
+        if (!client.readLatest(pixels, info)) {
+            continue;
+        }
+
+        uint64_t now = steadyMicros();
+        uint64_t latency = now > info.timestampUs ? now - info.timestampUs : 0;
+        latencySumUs += latency;
+        if (latency > maxLatencyUs) {
+            maxLatencyUs = latency;
+        }
+        if (previous != 0 && info.frameCounter > previous + 1) {
+            framesDropped += info.frameCounter - previous - 1;
+        }
+        framesRead++;
+
+        if (!dumpPath.empty()) {
+            if (writePam(dumpPath, pixels, info)) {
+                std::cout << "Wrote frame " << info.frameCounter << " (" << info.width << "x"
+                          << info.height << ") to " << dumpPath << std::endl;
+            } else {
+                std::cerr << "Failed to write " << dumpPath << std::endl;
+            }
+            dumpPath.clear();
+        }
+
+        auto nowTime = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(nowTime - windowStart).count();
+        if (elapsed >= 1.0) {
+            std::printf("%ux%u  %.1f fps  latency avg %.2f ms max %.2f ms  dropped %llu  torn %llu\n",
+                        info.width, info.height, framesRead / elapsed,
+                        framesRead ? latencySumUs / 1000.0 / framesRead : 0.0, maxLatencyUs / 1000.0,
+                        static_cast<unsigned long long>(framesDropped),
+                        static_cast<unsigned long long>(client.getTornReads()));
+            std::fflush(stdout);
+            framesRead = 0;
+            framesDropped = 0;
+            latencySumUs = 0;
+            maxLatencyUs = 0;
+            windowStart = nowTime;
+        }
+    }
+
+    return 0;
+}
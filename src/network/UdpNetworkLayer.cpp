@@ -61,13 +61,18 @@ bool UdpPublisher::publish(const TextMessage& message) {
 
     std::lock_guard<std::mutex> lock(socketMutex_);
 
-    // Serialize message
-    std::vector<uint8_t> buffer(1024);
-    size_t size = message.serialize(buffer.data(), buffer.size());
+    // Serialize message - header plus the text in use
+    uint8_t buffer[TextMessage::getMaxSerializedSize()];
+    size_t size = message.serialize(buffer, sizeof(buffer));
+    if (size == 0) {
+        stats_.setLastError("Serialize failed");
+        stats_.errors++;
+        return false;
+    }
 
     // Send UDP packet
     auto startTime = std::chrono::high_resolution_clock::now();
-    ssize_t sent = sendto(socket_, buffer.data(), size, 0,
+    ssize_t sent = sendto(socket_, buffer, size, 0,
                          (struct sockaddr*)&destAddr_, sizeof(destAddr_));
 
     if (sent < 0) {
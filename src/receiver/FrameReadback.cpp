@@ -0,0 +1,275 @@
+#include "FrameReadback.h"
+#include <algorithm>
+#include <iostream>
+
+namespace LiveText {
+
+namespace {
+
+uint64_t steadyMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+FrameReadback::FrameReadback()
+    : initialized_(false)
+    , width_(0)
+    , height_(0)
+    , frameBytes_(0)
+    , readFrameBuffer_(0)
+    , submitCounter_(0)
+    , running_(false)
+    , windowBytes_(0)
+{
+}
+
+FrameReadback::~FrameReadback() {
+    shutdown();
+}
+
+bool FrameReadback::initialize(int width, int height, int pboCount) {
+    if (initialized_) {
+        return true;
+    }
+
+    width_ = width;
+    height_ = height;
+    frameBytes_ = static_cast<size_t>(width_) * height_ * 4;  // RGBA8
+
+    glGenFramebuffers(1, &readFrameBuffer_);
+
+    for (int i = 0; i < pboCount; ++i) {
+        auto slot = std::make_unique<Slot>();
+        glGenBuffers(1, &slot->pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frameBytes_, nullptr, GL_STREAM_READ);
+        slots_.push_back(std::move(slot));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    windowStart_ = std::chrono::steady_clock::now();
+    running_ = true;
+    workerThread_ = std::thread(&FrameReadback::workerLoop, this);
+
+    initialized_ = true;
+    std::cout << "Frame readback initialized: " << pboCount << " PBOs of "
+              << (frameBytes_ / (1024 * 1024)) << " MB (" << width_ << "x" << height_ << ")" << std::endl;
+    return true;
+}
+
+void FrameReadback::shutdown() {
+    running_ = false;
+    queueCondition_.notify_all();
+    if (workerThread_.joinable()) {
+        workerThread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        deliveryQueue_.clear();
+    }
+
+    for (auto& slot : slots_) {
+        SlotState state = slot->state.load();
+        if (state == SlotState::MAPPED || state == SlotState::DELIVERED) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        if (slot->fence) {
+            glDeleteSync(slot->fence);
+            slot->fence = nullptr;
+        }
+        if (slot->pbo) {
+            glDeleteBuffers(1, &slot->pbo);
+            slot->pbo = 0;
+        }
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slots_.clear();
+
+    if (readFrameBuffer_) {
+        glDeleteFramebuffers(1, &readFrameBuffer_);
+        readFrameBuffer_ = 0;
+    }
+
+    initialized_ = false;
+}
+
+void FrameReadback::addSink(std::shared_ptr<FrameSink> sink) {
+    if (!sink) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    sinks_.push_back(std::move(sink));
+}
+
+void FrameReadback::removeSink(const std::string& name) {
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    sinks_.erase(std::remove_if(sinks_.begin(), sinks_.end(),
+                                [&name](const std::shared_ptr<FrameSink>& s) { return s->getName() == name; }),
+                 sinks_.end());
+}
+
+bool FrameReadback::hasSinks() const {
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    return !sinks_.empty();
+}
+
+void FrameReadback::submit(GLuint texture) {
+    if (!initialized_ || texture == 0) {
+        return;
+    }
+
+    serviceSlots();
+
+    // Find a free PBO - if every one is in flight, skip this frame instead of stalling
+    Slot* target = nullptr;
+    for (auto& slot : slots_) {
+        if (slot->state.load() == SlotState::FREE) {
+            target = slot.get();
+            break;
+        }
+    }
+
+    uint64_t frameNumber = 0;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        frameNumber = ++stats_.framesSubmitted;
+        if (!target) {
+            stats_.framesSkipped++;
+            return;
+        }
+    }
+
+    // Attach the texture to our read framebuffer and start the async copy into the PBO
+    GLint previousReadFrameBuffer = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadFrameBuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFrameBuffer_);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, target->pbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previousReadFrameBuffer);
+
+    target->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    target->frameNumber = frameNumber;
+    target->submitIndex = ++submitCounter_;
+    target->timestampUs = steadyMicros();
+    target->state = SlotState::PENDING;
+
+    // Make sure the copy actually starts - the fence is polled, never waited on
+    glFlush();
+}
+
+void FrameReadback::poll() {
+    if (initialized_) {
+        serviceSlots();
+    }
+}
+
+void FrameReadback::serviceSlots() {
+    for (auto& slotPtr : slots_) {
+        Slot& slot = *slotPtr;
+        SlotState state = slot.state.load();
+
+        if (state == SlotState::DELIVERED) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            slot.mapped = nullptr;
+            slot.state = SlotState::FREE;
+        } else if (state == SlotState::PENDING) {
+            // Zero timeout: only map once the GPU copy has finished
+            GLenum result = glClientWaitSync(slot.fence, 0, 0);
+            if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+                continue;
+            }
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameBytes_, GL_MAP_READ_BIT);
+            if (!mapped) {
+                slot.state = SlotState::FREE;
+                continue;
+            }
+            slot.mapped = static_cast<const uint8_t*>(mapped);
+            slot.state = SlotState::MAPPED;
+
+            {
+                std::lock_guard<std::mutex> lock(statsMutex_);
+                double latency = static_cast<double>(submitCounter_ - slot.submitIndex);
+                stats_.avgLatencyFrames = stats_.framesDelivered == 0
+                    ? latency : stats_.avgLatencyFrames * 0.9 + latency * 0.1;
+            }
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                deliveryQueue_.push_back(&slot);
+            }
+            queueCondition_.notify_one();
+        }
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FrameReadback::workerLoop() {
+    while (running_) {
+        Slot* slot = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCondition_.wait(lock, [this] { return !running_ || !deliveryQueue_.empty(); });
+            if (!running_) {
+                break;
+            }
+            slot = deliveryQueue_.front();
+            deliveryQueue_.pop_front();
+        }
+
+        deliver(*slot);
+        slot->state = SlotState::DELIVERED;
+    }
+}
+
+void FrameReadback::deliver(Slot& slot) {
+    CpuFrame frame;
+    frame.data = slot.mapped;
+    frame.width = width_;
+    frame.height = height_;
+    frame.stride = width_ * 4;
+    frame.size = frameBytes_;
+    frame.bottomUp = true;
+    frame.frameNumber = slot.frameNumber;
+    frame.timestampUs = slot.timestampUs;
+
+    std::vector<std::shared_ptr<FrameSink>> sinks;
+    {
+        std::lock_guard<std::mutex> lock(sinksMutex_);
+        sinks = sinks_;
+    }
+    for (auto& sink : sinks) {
+        sink->onFrame(frame);
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.framesDelivered++;
+    windowBytes_ += frameBytes_;
+
+    // Throughput over roughly one-second windows
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - windowStart_).count();
+    if (elapsed >= 1.0) {
+        stats_.throughputMBps = (windowBytes_ / (1024.0 * 1024.0)) / elapsed;
+        windowBytes_ = 0;
+        windowStart_ = now;
+    }
+}
+
+ReadbackStats FrameReadback::getStats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+}
+
+} // namespace LiveText
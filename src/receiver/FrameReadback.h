@@ -0,0 +1,104 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "FrameSink.h"
+
+namespace LiveText {
+
+struct ReadbackStats {
+    uint64_t framesSubmitted = 0;
+    uint64_t framesDelivered = 0;
+    uint64_t framesSkipped = 0;     // No free PBO - frame not read back rather than stalling
+    double avgLatencyFrames = 0.0;  // Submits between issuing a readback and its delivery
+    double throughputMBps = 0.0;    // Delivered bytes over the last measurement window
+};
+
+// Asynchronous GPU->CPU readback through a ring of pixel buffer objects.
+// submit() is called on the GL thread once per frame and never waits: it
+// issues glReadPixels into a free PBO, fences it, and maps PBOs whose fences
+// have signalled. A worker thread hands mapped frames to the sinks; the GL
+// thread unmaps them on a later submit().
+class FrameReadback {
+public:
+    static constexpr int DEFAULT_PBO_COUNT = 3;
+
+    FrameReadback();
+    ~FrameReadback();
+
+    bool initialize(int width, int height, int pboCount = DEFAULT_PBO_COUNT);
+    void shutdown();
+
+    void addSink(std::shared_ptr<FrameSink> sink);
+    void removeSink(const std::string& name);
+    bool hasSinks() const;
+
+    // GL thread only
+    void submit(GLuint texture);
+    void poll();
+
+    ReadbackStats getStats() const;
+    bool isInitialized() const { return initialized_; }
+
+private:
+    enum class SlotState {
+        FREE,       // Available for a new readback
+        PENDING,    // glReadPixels issued, waiting on the fence
+        MAPPED,     // Mapped and queued for (or being delivered by) the worker
+        DELIVERED   // Worker finished - GL thread must unmap
+    };
+
+    struct Slot {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;
+        std::atomic<SlotState> state{SlotState::FREE};
+        const uint8_t* mapped = nullptr;
+        uint64_t frameNumber = 0;
+        uint64_t submitIndex = 0;
+        uint64_t timestampUs = 0;
+    };
+
+    bool initialized_;
+    int width_, height_;
+    size_t frameBytes_;
+    GLuint readFrameBuffer_;
+    std::vector<std::unique_ptr<Slot>> slots_;
+    uint64_t submitCounter_;
+
+    // Sinks
+    mutable std::mutex sinksMutex_;
+    std::vector<std::shared_ptr<FrameSink>> sinks_;
+
+    // Worker
+    std::thread workerThread_;
+    std::atomic<bool> running_;
+    std::mutex queueMutex_;
+    std::condition_variable queueCondition_;
+    std::deque<Slot*> deliveryQueue_;
+
+    // Statistics
+    mutable std::mutex statsMutex_;
+    ReadbackStats stats_;
+    uint64_t windowBytes_;
+    std::chrono::steady_clock::time_point windowStart_;
+
+    void serviceSlots();
+    void workerLoop();
+    void deliver(Slot& slot);
+};
+
+} // namespace LiveText
@@ -0,0 +1,134 @@
+#include "FrameScheduler.h"
+#include <cmath>
+#include <cstdlib>
+
+namespace LiveText {
+
+bool FrameRate::parse(const std::string& text, FrameRate& rate) {
+    char* end = nullptr;
+    double fps = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || *end != '\0' || fps <= 0.0 || fps > 1000.0) {
+        return false;
+    }
+
+    // 23.976, 29.97, 59.94 ... are N * 1000/1001
+    double ntscBase = std::round(fps * 1.001);
+    if (std::fabs(fps - std::round(fps)) > 0.001 && std::fabs(fps - ntscBase * 1000.0 / 1001.0) < 0.01) {
+        rate.numerator = static_cast<int64_t>(ntscBase) * 1000;
+        rate.denominator = 1001;
+    } else if (std::fabs(fps - std::round(fps)) < 0.001) {
+        rate.numerator = static_cast<int64_t>(std::round(fps));
+        rate.denominator = 1;
+    } else {
+        rate.numerator = static_cast<int64_t>(std::round(fps * 1000.0));
+        rate.denominator = 1000;
+    }
+    return true;
+}
+
+FrameScheduler::FrameScheduler(FrameRate rate, WakePolicy policy)
+    : rate_(rate)
+    , policy_(policy)
+    , nextTick_(0)
+    , pendingNotify_(false)
+    , windowFrames_(0)
+    , windowDeadlineWakes_(0)
+    , windowJitterSumUs_(0.0)
+    , windowJitterMaxUs_(0.0)
+{
+    stats_.targetFps = rate_.fps();
+}
+
+void FrameScheduler::start() {
+    epoch_ = Clock::now();
+    nextTick_ = 1;
+    windowStart_ = epoch_;
+}
+
+FrameScheduler::Clock::time_point FrameScheduler::deadline(int64_t tick) const {
+    // tick * den / num seconds, split so the nanosecond product cannot overflow
+    int64_t scaled = tick * rate_.denominator;
+    int64_t seconds = scaled / rate_.numerator;
+    int64_t remainderNs = (scaled % rate_.numerator) * 1000000000LL / rate_.numerator;
+    return epoch_ + std::chrono::seconds(seconds) + std::chrono::nanoseconds(remainderNs);
+}
+
+WakeReason FrameScheduler::waitForNextFrame() {
+    auto now = Clock::now();
+
+    // A frame overran by more than a period - drop the ticks already past instead of bursting
+    int64_t elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - epoch_).count();
+    int64_t currentTick = static_cast<int64_t>(
+        (static_cast<double>(elapsedNs) * rate_.numerator) / (rate_.denominator * 1e9));
+    if (currentTick > nextTick_) {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats_.missedDeadlines += static_cast<uint64_t>(currentTick - nextTick_);
+        nextTick_ = currentTick;
+    }
+
+    Clock::time_point target = deadline(nextTick_);
+    bool messageWake = false;
+    {
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        messageWake = wakeCondition_.wait_until(lock, target, [this] {
+            return policy_ == WakePolicy::WAKE_ON_MESSAGE && pendingNotify_;
+        });
+        pendingNotify_ = false;
+    }
+    auto wake = Clock::now();
+
+    WakeReason reason = messageWake ? WakeReason::MESSAGE : WakeReason::DEADLINE;
+    if (reason == WakeReason::DEADLINE) {
+        nextTick_++;
+    } else if (target - wake < (deadline(nextTick_ + 1) - target) / 2) {
+        // Close enough to the deadline that this frame stands in for it
+        nextTick_++;
+    }
+
+    recordFrame(reason, wake, target);
+    return reason;
+}
+
+void FrameScheduler::notify() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        pendingNotify_ = true;
+    }
+    wakeCondition_.notify_one();
+}
+
+void FrameScheduler::recordFrame(WakeReason reason, Clock::time_point wake, Clock::time_point target) {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+
+    windowFrames_++;
+    if (reason == WakeReason::DEADLINE) {
+        stats_.deadlineFrames++;
+        double jitterUs = std::chrono::duration<double, std::micro>(wake - target).count();
+        windowDeadlineWakes_++;
+        windowJitterSumUs_ += jitterUs;
+        if (jitterUs > windowJitterMaxUs_) {
+            windowJitterMaxUs_ = jitterUs;
+        }
+    } else {
+        stats_.messageFrames++;
+    }
+
+    double elapsed = std::chrono::duration<double>(wake - windowStart_).count();
+    if (elapsed >= 1.0) {
+        stats_.actualFps = windowFrames_ / elapsed;
+        stats_.avgJitterUs = windowDeadlineWakes_ ? windowJitterSumUs_ / windowDeadlineWakes_ : 0.0;
+        stats_.maxJitterUs = windowJitterMaxUs_;
+        windowFrames_ = 0;
+        windowDeadlineWakes_ = 0;
+        windowJitterSumUs_ = 0.0;
+        windowJitterMaxUs_ = 0.0;
+        windowStart_ = wake;
+    }
+}
+
+SchedulerStats FrameScheduler::getStats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+}
+
+} // namespace LiveText
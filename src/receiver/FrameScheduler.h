@@ -0,0 +1,85 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace LiveText {
+
+// Output rate as an exact ratio so 59.94 (60000/1001) does not drift
+struct FrameRate {
+    int64_t numerator = 60;
+    int64_t denominator = 1;
+
+    double fps() const { return static_cast<double>(numerator) / denominator; }
+
+    // Accepts "50", "59.94", "60", "29.97", ... - NTSC rates map to N*1000/1001
+    static bool parse(const std::string& text, FrameRate& rate);
+};
+
+enum class WakePolicy {
+    DEADLINE_ONLY,    // Messages are picked up on the next tick of the output clock
+    WAKE_ON_MESSAGE   // A new message renders immediately, then the clock resumes
+};
+
+enum class WakeReason {
+    DEADLINE,
+    MESSAGE
+};
+
+struct SchedulerStats {
+    double targetFps = 0.0;
+    double actualFps = 0.0;        // Frames per second over the last window
+    double avgJitterUs = 0.0;      // Mean lateness of deadline wakeups over the last window
+    double maxJitterUs = 0.0;      // Worst lateness over the last window
+    uint64_t deadlineFrames = 0;
+    uint64_t messageFrames = 0;    // Early frames triggered by notify()
+    uint64_t missedDeadlines = 0;  // Ticks skipped because a frame overran its slot
+};
+
+// Paces the receiver's render loop to a fixed output rate using absolute
+// deadlines (epoch + n * period), so oversleeping on one frame never shifts
+// the following ones. notify() may be called from any thread to wake the
+// loop early when new content arrives.
+class FrameScheduler {
+public:
+    FrameScheduler(FrameRate rate, WakePolicy policy);
+
+    void start();
+
+    // Blocks until the next deadline or, if the policy allows, a notify()
+    WakeReason waitForNextFrame();
+    void notify();
+
+    SchedulerStats getStats() const;
+    FrameRate getRate() const { return rate_; }
+    WakePolicy getPolicy() const { return policy_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    FrameRate rate_;
+    WakePolicy policy_;
+
+    Clock::time_point epoch_;
+    int64_t nextTick_;  // Index of the next deadline since epoch_
+
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    bool pendingNotify_;
+
+    // Statistics - current window and last completed window
+    mutable std::mutex statsMutex_;
+    SchedulerStats stats_;
+    Clock::time_point windowStart_;
+    uint64_t windowFrames_;
+    uint64_t windowDeadlineWakes_;
+    double windowJitterSumUs_;
+    double windowJitterMaxUs_;
+
+    Clock::time_point deadline(int64_t tick) const;
+    void recordFrame(WakeReason reason, Clock::time_point wake, Clock::time_point target);
+};
+
+} // namespace LiveText
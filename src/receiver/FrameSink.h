@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace LiveText {
+
+// A rendered frame in CPU memory. The pixel data is only valid for the
+// duration of FrameSink::onFrame - sinks that need it later must copy it.
+struct CpuFrame {
+    const uint8_t* data = nullptr;
+    int width = 0;
+    int height = 0;
+    int stride = 0;             // Bytes per row
+    size_t size = 0;            // Total bytes at data
+    bool bottomUp = true;       // OpenGL row order: first row is the bottom of the image
+    uint64_t frameNumber = 0;   // Sender-local frame counter
+    uint64_t timestampUs = 0;   // Steady clock time the readback was issued
+};
+
+// Receives frames from the readback engine on its worker thread
+class FrameSink {
+public:
+    virtual ~FrameSink() = default;
+
+    virtual void onFrame(const CpuFrame& frame) = 0;
+    virtual std::string getName() const = 0;
+};
+
+// Simplest sink: forwards every frame to a callback
+class CallbackFrameSink : public FrameSink {
+public:
+    using FrameCallback = std::function<void(const CpuFrame&)>;
+
+    CallbackFrameSink(const std::string& name, FrameCallback callback)
+        : name_(name)
+        , callback_(std::move(callback))
+    {}
+
+    void onFrame(const CpuFrame& frame) override {
+        if (callback_) {
+            callback_(frame);
+        }
+    }
+
+    std::string getName() const override { return name_; }
+
+private:
+    std::string name_;
+    FrameCallback callback_;
+};
+
+} // namespace LiveText
@@ -0,0 +1,445 @@
+#include "GlyphAtlas.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LiveText {
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x4147544C;   // 'LTGA'
+constexpr uint32_t CACHE_VERSION = 1;          // Bump when the layout or rasterization changes
+constexpr size_t MAX_SIZES = 4;
+constexpr size_t PIXEL_ALIGNMENT = 4096;       // Page-aligned pixels in the mapping
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fontHash;
+    uint32_t freetypeVersion;
+    uint32_t sizeCount;
+    uint32_t pixelSizes[MAX_SIZES];
+    uint32_t glyphCount;
+    uint32_t width;
+    uint32_t height;
+    uint32_t padding;
+    uint64_t glyphOffset;
+    uint64_t pixelOffset;
+};
+
+constexpr uint32_t freetypeVersion() {
+    return (FREETYPE_MAJOR << 16) | (FREETYPE_MINOR << 8) | FREETYPE_PATCH;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool createDirectories(const std::string& path) {
+    for (size_t pos = 1; pos <= path.size(); ++pos) {
+        if (pos != path.size() && path[pos] != '/' && path[pos] != '\\') {
+            continue;
+        }
+        std::string partial = path.substr(0, pos);
+#ifdef _WIN32
+        _mkdir(partial.c_str());
+#else
+        mkdir(partial.c_str(), 0755);
+#endif
+    }
+#ifdef _WIN32
+    struct _stat info;
+    return _stat(path.c_str(), &info) == 0 && (info.st_mode & _S_IFDIR);
+#else
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+#endif
+}
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas()
+    : width_(0)
+    , height_(0)
+    , workerCount_(0)
+    , pixelData_(nullptr)
+{
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    releasePixels();
+}
+
+bool GlyphAtlas::build(const std::string& fontPath, const std::vector<int>& pixelSizes, int maxWidth) {
+    if (pixelSizes.empty() || pixelSizes.size() > MAX_SIZES) {
+        std::cerr << "Glyph atlas supports 1-" << MAX_SIZES << " pixel sizes" << std::endl;
+        return false;
+    }
+    stats_ = GlyphAtlasStats();
+
+    // The mapping is hashed for the cache key and, on a miss, shared by every rasterizer
+    auto start = std::chrono::steady_clock::now();
+    MappedFile font;
+    if (!font.openRead(fontPath)) {
+        return false;
+    }
+    uint64_t fontHash = hashFile(font);
+    stats_.hashMs = millisecondsSince(start);
+
+    std::string cachePath = getCachePath(fontHash, pixelSizes);
+    stats_.cachePath = cachePath;
+
+    start = std::chrono::steady_clock::now();
+    if (loadCache(cachePath, fontHash, pixelSizes, maxWidth)) {
+        stats_.cacheLoadMs = millisecondsSince(start);
+        stats_.cacheHit = true;
+        return true;
+    }
+
+    std::vector<std::vector<uint8_t>> bitmaps;
+    if (!rasterize(font, pixelSizes, bitmaps) || !pack(bitmaps, maxWidth)) {
+        return false;
+    }
+
+    start = std::chrono::steady_clock::now();
+    if (!writeCache(cachePath, fontHash, pixelSizes)) {
+        std::cerr << "Could not write glyph cache " << cachePath << " - next start will rasterize again" << std::endl;
+    }
+    stats_.cacheWriteMs = millisecondsSince(start);
+    return true;
+}
+
+bool GlyphAtlas::loadCache(const std::string& path, uint64_t fontHash, const std::vector<int>& pixelSizes, int maxWidth) {
+    if (!cacheFile_.openRead(path)) {
+        return false;
+    }
+
+    // Validate everything before trusting a single offset - the file may be stale or truncated
+    CacheHeader header;
+    bool valid = cacheFile_.size() >= sizeof(header);
+    if (valid) {
+        std::memcpy(&header, cacheFile_.data(), sizeof(header));
+        valid = header.magic == CACHE_MAGIC &&
+                header.version == CACHE_VERSION &&
+                header.fontHash == fontHash &&
+                header.freetypeVersion == freetypeVersion() &&
+                header.sizeCount == pixelSizes.size() &&
+                header.glyphCount == pixelSizes.size() * GLYPH_COUNT &&
+                header.padding == static_cast<uint32_t>(PADDING) &&
+                header.width > 0 && header.height > 0 &&
+                header.width <= static_cast<uint32_t>(maxWidth) &&
+                header.height <= static_cast<uint32_t>(maxWidth);
+    }
+    for (size_t i = 0; valid && i < pixelSizes.size(); ++i) {
+        valid = header.pixelSizes[i] == static_cast<uint32_t>(pixelSizes[i]);
+    }
+    uint64_t glyphBytes = static_cast<uint64_t>(header.glyphCount) * sizeof(AtlasGlyph);
+    uint64_t pixelBytes = static_cast<uint64_t>(header.width) * header.height;
+    valid = valid &&
+            header.glyphOffset + glyphBytes <= cacheFile_.size() &&
+            header.pixelOffset + pixelBytes <= cacheFile_.size();
+
+    if (!valid) {
+        cacheFile_.close();
+        return false;
+    }
+
+    glyphs_.resize(header.glyphCount);
+    std::memcpy(glyphs_.data(), cacheFile_.data() + header.glyphOffset, glyphBytes);
+    for (const auto& glyph : glyphs_) {
+        if (glyph.present && (glyph.x + glyph.width > header.width || glyph.y + glyph.height > header.height)) {
+            glyphs_.clear();
+            cacheFile_.close();
+            return false;
+        }
+    }
+
+    width_ = static_cast<int>(header.width);
+    height_ = static_cast<int>(header.height);
+    pixelData_ = cacheFile_.data() + header.pixelOffset;
+    return true;
+}
+
+bool GlyphAtlas::rasterize(const MappedFile& font, const std::vector<int>& pixelSizes,
+                           std::vector<std::vector<uint8_t>>& bitmaps) {
+    auto start = std::chrono::steady_clock::now();
+
+    glyphs_.assign(pixelSizes.size() * GLYPH_COUNT, AtlasGlyph());
+    bitmaps.assign(glyphs_.size(), std::vector<uint8_t>());
+
+    int workers = workerCount_;
+    if (workers <= 0) {
+        workers = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    workers = std::max(1, std::min({workers, MAX_WORKERS, static_cast<int>(glyphs_.size())}));
+
+    // Glyphs are claimed one at a time, largest size first, so no worker is left
+    // holding a run of big glyphs at the end. Each worker writes only the slots it claimed.
+    std::atomic<size_t> nextGlyph(0);
+    std::atomic<bool> failed(false);
+
+    auto worker = [&]() {
+        FT_Library library;
+        if (FT_Init_FreeType(&library)) {
+            std::cerr << "Could not init FreeType Library" << std::endl;
+            failed = true;
+            return;
+        }
+        FT_Face face;
+        if (FT_New_Memory_Face(library, font.data(), static_cast<FT_Long>(font.size()), 0, &face)) {
+            FT_Done_FreeType(library);
+            failed = true;
+            return;
+        }
+
+        size_t currentSize = pixelSizes.size();
+        for (size_t claim = nextGlyph++; claim < glyphs_.size() && !failed; claim = nextGlyph++) {
+            size_t sizeIndex = pixelSizes.size() - 1 - claim / GLYPH_COUNT;
+            int code = static_cast<int>(claim % GLYPH_COUNT);
+            if (sizeIndex != currentSize) {
+                FT_Set_Pixel_Sizes(face, 0, pixelSizes[sizeIndex]);
+                currentSize = sizeIndex;
+            }
+            if (FT_Load_Char(face, code, FT_LOAD_RENDER)) {
+                continue;
+            }
+            const FT_GlyphSlot slot = face->glyph;
+            const FT_Bitmap& bitmap = slot->bitmap;
+            size_t index = sizeIndex * GLYPH_COUNT + code;
+
+            AtlasGlyph& glyph = glyphs_[index];
+            glyph.width = static_cast<uint16_t>(bitmap.width);
+            glyph.height = static_cast<uint16_t>(bitmap.rows);
+            glyph.bearingX = static_cast<int16_t>(slot->bitmap_left);
+            glyph.bearingY = static_cast<int16_t>(slot->bitmap_top);
+            glyph.advance = static_cast<int32_t>(slot->advance.x);
+            glyph.present = 1;
+
+            // Tightly packed copy - FreeType rows may be padded
+            std::vector<uint8_t>& pixels = bitmaps[index];
+            pixels.resize(static_cast<size_t>(bitmap.width) * bitmap.rows);
+            for (unsigned int row = 0; row < bitmap.rows; ++row) {
+                const uint8_t* source = bitmap.buffer + static_cast<ptrdiff_t>(row) * bitmap.pitch;
+                std::memcpy(pixels.data() + static_cast<size_t>(row) * bitmap.width, source, bitmap.width);
+            }
+        }
+
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < workers; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    stats_.workers = workers;
+    stats_.glyphsRasterized = glyphs_.size();
+    stats_.rasterizeMs = millisecondsSince(start);
+    return !failed;
+}
+
+bool GlyphAtlas::pack(const std::vector<std::vector<uint8_t>>& bitmaps, int maxWidth) {
+    // Shelf packing, tallest first so each shelf wastes little height
+    auto start = std::chrono::steady_clock::now();
+    std::vector<size_t> order;
+    for (size_t i = 0; i < glyphs_.size(); ++i) {
+        if (glyphs_[i].present && glyphs_[i].width > 0 && glyphs_[i].height > 0) {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return glyphs_[a].height > glyphs_[b].height;
+    });
+
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    int usedWidth = 1;
+    for (size_t index : order) {
+        AtlasGlyph& glyph = glyphs_[index];
+        int cellWidth = glyph.width + PADDING;
+        if (cellWidth > maxWidth) {
+            std::cerr << "Glyph wider than the atlas (" << glyph.width << " > " << maxWidth << ")" << std::endl;
+            return false;
+        }
+        if (x + cellWidth > maxWidth) {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        glyph.x = static_cast<uint16_t>(x);
+        glyph.y = static_cast<uint16_t>(y);
+        x += cellWidth;
+        shelfHeight = std::max(shelfHeight, glyph.height + PADDING);
+        usedWidth = std::max(usedWidth, x);
+    }
+    width_ = usedWidth;
+    height_ = std::max(1, y + shelfHeight);
+    if (height_ > maxWidth) {
+        std::cerr << "Glyph atlas doesn't fit in " << maxWidth << "x" << maxWidth << std::endl;
+        return false;
+    }
+
+    pixels_.assign(static_cast<size_t>(width_) * height_, 0);
+    for (size_t index : order) {
+        const AtlasGlyph& glyph = glyphs_[index];
+        const std::vector<uint8_t>& source = bitmaps[index];
+        for (int row = 0; row < glyph.height; ++row) {
+            std::memcpy(pixels_.data() + static_cast<size_t>(glyph.y + row) * width_ + glyph.x,
+                        source.data() + static_cast<size_t>(row) * glyph.width, glyph.width);
+        }
+    }
+    pixelData_ = pixels_.data();
+    stats_.packMs = millisecondsSince(start);
+    return true;
+}
+
+bool GlyphAtlas::writeCache(const std::string& path, uint64_t fontHash, const std::vector<int>& pixelSizes) const {
+    if (!createDirectories(getCacheDirectory())) {
+        return false;
+    }
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.fontHash = fontHash;
+    header.freetypeVersion = freetypeVersion();
+    header.sizeCount = static_cast<uint32_t>(pixelSizes.size());
+    for (size_t i = 0; i < pixelSizes.size(); ++i) {
+        header.pixelSizes[i] = static_cast<uint32_t>(pixelSizes[i]);
+    }
+    header.glyphCount = static_cast<uint32_t>(glyphs_.size());
+    header.width = static_cast<uint32_t>(width_);
+    header.height = static_cast<uint32_t>(height_);
+    header.padding = PADDING;
+    header.glyphOffset = sizeof(header);
+    uint64_t glyphEnd = header.glyphOffset + glyphs_.size() * sizeof(AtlasGlyph);
+    header.pixelOffset = (glyphEnd + PIXEL_ALIGNMENT - 1) / PIXEL_ALIGNMENT * PIXEL_ALIGNMENT;
+
+    // Write to a temporary name and rename, so a concurrent reader never sees a partial file
+#ifdef _WIN32
+    std::string tempPath = path + ".tmp" + std::to_string(_getpid());
+#else
+    std::string tempPath = path + ".tmp" + std::to_string(getpid());
+#endif
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(glyphs_.data()), glyphs_.size() * sizeof(AtlasGlyph));
+        std::vector<char> alignment(header.pixelOffset - glyphEnd, 0);
+        file.write(alignment.data(), alignment.size());
+        file.write(reinterpret_cast<const char*>(pixelData_), static_cast<std::streamsize>(width_) * height_);
+        if (!file) {
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+GLuint GlyphAtlas::createTexture() {
+    if (!pixelData_) {
+        return 0;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width_, height_, 0, GL_RED, GL_UNSIGNED_BYTE, pixelData_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    stats_.uploadMs = millisecondsSince(start);
+    return texture;
+}
+
+void GlyphAtlas::releasePixels() {
+    pixelData_ = nullptr;
+    std::vector<uint8_t>().swap(pixels_);
+    cacheFile_.close();
+}
+
+uint64_t GlyphAtlas::hashFile(const MappedFile& file) {
+    // FNV-1a 64
+    uint64_t hash = 14695981039346656037ull;
+    const uint8_t* data = file.data();
+    for (size_t i = 0; i < file.size(); ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string GlyphAtlas::getCacheDirectory() {
+    if (const char* directory = std::getenv("LIVETEXT_CACHE_DIR")) {
+        return directory;
+    }
+#ifdef _WIN32
+    if (const char* localAppData = std::getenv("LOCALAPPDATA")) {
+        return std::string(localAppData) + "\\LiveText\\glyphs";
+    }
+#elif __APPLE__
+    if (const char* home = std::getenv("HOME")) {
+        return std::string(home) + "/Library/Caches/LiveText/glyphs";
+    }
+#else
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME")) {
+        return std::string(xdg) + "/livetext/glyphs";
+    }
+    if (const char* home = std::getenv("HOME")) {
+        return std::string(home) + "/.cache/livetext/glyphs";
+    }
+#endif
+    return ".livetext-cache";
+}
+
+std::string GlyphAtlas::getCachePath(uint64_t fontHash, const std::vector<int>& pixelSizes) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fontHash));
+    std::string path = getCacheDirectory() + "/" + name;
+    for (int size : pixelSizes) {
+        path += "-" + std::to_string(size);
+    }
+    return path + ".ltga";
+}
+
+} // namespace LiveText
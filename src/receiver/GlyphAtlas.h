@@ -0,0 +1,101 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/MappedFile.h"
+
+namespace LiveText {
+
+// Placement and metrics of one glyph in the atlas. Stored verbatim in the cache file.
+struct AtlasGlyph {
+    uint16_t x, y;              // Top-left texel in the atlas
+    uint16_t width, height;     // Bitmap size
+    int16_t bearingX, bearingY; // Offset from the pen position to the bitmap's left/top
+    int32_t advance;            // 26.6 fixed point, as FreeType reports it
+    uint32_t present;           // 0 if FreeType had no glyph for this code
+};
+
+struct GlyphAtlasStats {
+    bool cacheHit = false;
+    std::string cachePath;
+    double hashMs = 0.0;        // Hashing the font file for the cache key
+    double cacheLoadMs = 0.0;   // Mapping and validating the cache file
+    double rasterizeMs = 0.0;   // Cache miss only - wall clock across all workers
+    int workers = 0;
+    size_t glyphsRasterized = 0;
+    double packMs = 0.0;
+    double cacheWriteMs = 0.0;
+    double uploadMs = 0.0;
+};
+
+// ASCII glyphs for a set of pixel sizes, packed into a single 8-bit atlas.
+//
+// The rasterized atlas and metrics are cached on disk, keyed by a hash of the
+// font file's contents plus the pixel sizes, FreeType version and format
+// version. A cache hit memory-maps the file and uploads the pixels straight
+// from the mapping with one glTexImage2D - FreeType is never opened. A miss
+// rasterizes, packs and writes the cache for next time.
+//
+// Rasterization fans out over worker threads, each with its own FT_Library
+// and FT_Face over the shared font mapping (FreeType objects are not thread
+// safe). Packing and the cache write run once all bitmaps are in; the GL
+// upload is left to the caller's thread.
+class GlyphAtlas {
+public:
+    static constexpr int GLYPH_COUNT = 128;
+    static constexpr int PADDING = 2;           // Texels between glyphs so linear filtering can't bleed
+    static constexpr int DEFAULT_WIDTH = 4096;
+    static constexpr int MAX_WORKERS = 8;
+
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    // Rasterization threads (0 = one per hardware thread, up to MAX_WORKERS)
+    void setWorkerCount(int workers) { workerCount_ = workers; }
+
+    // No GL calls. Fails if the font can't be opened.
+    bool build(const std::string& fontPath, const std::vector<int>& pixelSizes, int maxWidth);
+
+    // Context must be current. Creates the atlas texture; the caller owns it.
+    GLuint createTexture();
+
+    // Drop the pixel data (mapping or buffer) once the texture exists
+    void releasePixels();
+
+    const AtlasGlyph& getGlyph(size_t sizeIndex, int code) const { return glyphs_[sizeIndex * GLYPH_COUNT + code]; }
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    const GlyphAtlasStats& getStats() const { return stats_; }
+
+    // LIVETEXT_CACHE_DIR, else the platform's per-user cache directory
+    static std::string getCacheDirectory();
+
+private:
+    int width_, height_;
+    int workerCount_;
+    std::vector<AtlasGlyph> glyphs_;
+    std::vector<uint8_t> pixels_;   // Cache miss: freshly rasterized atlas
+    MappedFile cacheFile_;          // Cache hit: pixels live in the mapping
+    const uint8_t* pixelData_;
+    GlyphAtlasStats stats_;
+
+    bool loadCache(const std::string& path, uint64_t fontHash, const std::vector<int>& pixelSizes, int maxWidth);
+    bool rasterize(const MappedFile& font, const std::vector<int>& pixelSizes,
+                   std::vector<std::vector<uint8_t>>& bitmaps);
+    bool pack(const std::vector<std::vector<uint8_t>>& bitmaps, int maxWidth);
+    bool writeCache(const std::string& path, uint64_t fontHash, const std::vector<int>& pixelSizes) const;
+
+    static uint64_t hashFile(const MappedFile& file);
+    static std::string getCachePath(uint64_t fontHash, const std::vector<int>& pixelSizes);
+};
+
+} // namespace LiveText
@@ -0,0 +1,245 @@
+#include "GpuProfiler.h"
+#include <algorithm>
+#include <iostream>
+
+namespace LiveText {
+
+GpuProfiler::GpuProfiler()
+    : initialized_(false)
+    , frame_(0)
+    , gpuEpochNs_(0)
+    , cpuEpochUs_(0)
+    , exportEnabled_(false)
+{
+}
+
+GpuProfiler::~GpuProfiler() {
+    shutdown();
+}
+
+bool GpuProfiler::initialize(const std::vector<std::string>& passNames) {
+    shutdown();
+
+    passes_.resize(passNames.size());
+    for (size_t i = 0; i < passNames.size(); ++i) {
+        Pass& pass = passes_[i];
+        pass.name = passNames[i];
+        for (auto& slot : pass.slots) {
+            glGenQueries(1, &slot.beginQuery);
+            glGenQueries(1, &slot.endQuery);
+        }
+    }
+
+    // Map GPU timestamps onto steady_clock for export
+    GLint64 gpuNow = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+    gpuEpochNs_ = gpuNow;
+    cpuEpochUs_ = steadyMicros(std::chrono::steady_clock::now());
+
+    GLenum error = glGetError();
+    if (error != GL_NO_ERROR) {
+        std::cerr << "GPU timer queries unavailable (GL error " << error << ")" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    initialized_ = true;
+    return true;
+}
+
+void GpuProfiler::shutdown() {
+    for (auto& pass : passes_) {
+        for (auto& slot : pass.slots) {
+            if (slot.beginQuery) {
+                glDeleteQueries(1, &slot.beginQuery);
+                slot.beginQuery = 0;
+            }
+            if (slot.endQuery) {
+                glDeleteQueries(1, &slot.endQuery);
+                slot.endQuery = 0;
+            }
+        }
+    }
+    // Resolved samples stay queued for a final takeSamples()
+    std::lock_guard<std::mutex> lock(mutex_);
+    passes_.clear();
+    initialized_ = false;
+}
+
+void GpuProfiler::beginFrame() {
+    if (!initialized_) {
+        return;
+    }
+    frame_++;
+    for (auto& pass : passes_) {
+        collect(pass);
+    }
+}
+
+void GpuProfiler::collect(Pass& pass) {
+    // Oldest first; stop at the first slot the GPU hasn't finished
+    while (pass.slots[pass.readSlot].pending) {
+        Slot& slot = pass.slots[pass.readSlot];
+        GLint available = 0;
+        glGetQueryObjectiv(slot.endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            break;
+        }
+
+        GLuint64 beginNs = 0;
+        GLuint64 endNs = 0;
+        glGetQueryObjectui64v(slot.beginQuery, GL_QUERY_RESULT, &beginNs);
+        glGetQueryObjectui64v(slot.endQuery, GL_QUERY_RESULT, &endNs);
+        double gpuMs = endNs > beginNs ? (endNs - beginNs) / 1.0e6 : 0.0;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pass.gpuHistory[pass.gpuNext] = gpuMs;
+            pass.gpuNext = (pass.gpuNext + 1) % HISTORY_FRAMES;
+            pass.gpuCount = std::min(pass.gpuCount + 1, HISTORY_FRAMES);
+            pass.samples++;
+
+            if (exportEnabled_) {
+                GpuTimingSample sample;
+                sample.frame = slot.frame;
+                sample.pass = pass.name;
+                sample.cpuBeginUs = slot.cpuBeginUs;
+                sample.cpuMs = slot.cpuMs;
+                sample.gpuBeginUs = cpuEpochUs_ + (static_cast<int64_t>(beginNs) - gpuEpochNs_) / 1000;
+                sample.gpuEndUs = cpuEpochUs_ + (static_cast<int64_t>(endNs) - gpuEpochNs_) / 1000;
+                sample.gpuMs = gpuMs;
+                exportQueue_.push_back(sample);
+            }
+        }
+
+        slot.pending = false;
+        pass.readSlot = (pass.readSlot + 1) % QUERY_RING;
+    }
+}
+
+void GpuProfiler::beginPass(int pass) {
+    if (!initialized_ || pass < 0 || pass >= static_cast<int>(passes_.size())) {
+        return;
+    }
+    Pass& p = passes_[pass];
+    p.cpuBegin = std::chrono::steady_clock::now();
+
+    // All slots in flight: time this frame on the CPU only rather than wait
+    Slot& slot = p.slots[p.writeSlot];
+    p.active = !slot.pending;
+    if (p.active) {
+        glQueryCounter(slot.beginQuery, GL_TIMESTAMP);
+    }
+}
+
+void GpuProfiler::endPass(int pass) {
+    if (!initialized_ || pass < 0 || pass >= static_cast<int>(passes_.size())) {
+        return;
+    }
+    Pass& p = passes_[pass];
+    auto now = std::chrono::steady_clock::now();
+    double cpuMs = std::chrono::duration<double, std::milli>(now - p.cpuBegin).count();
+
+    bool timed = p.active;
+    if (timed) {
+        Slot& slot = p.slots[p.writeSlot];
+        glQueryCounter(slot.endQuery, GL_TIMESTAMP);
+        slot.pending = true;
+        slot.frame = frame_;
+        slot.cpuBeginUs = steadyMicros(p.cpuBegin);
+        slot.cpuMs = cpuMs;
+        p.writeSlot = (p.writeSlot + 1) % QUERY_RING;
+        p.active = false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    p.cpuHistory[p.cpuNext] = cpuMs;
+    p.cpuNext = (p.cpuNext + 1) % HISTORY_FRAMES;
+    p.cpuCount = std::min(p.cpuCount + 1, HISTORY_FRAMES);
+    if (!timed) {
+        p.skipped++;
+    }
+}
+
+void GpuProfiler::getTimings(std::vector<PassTiming>& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.resize(passes_.size());
+    for (size_t i = 0; i < passes_.size(); ++i) {
+        const Pass& pass = passes_[i];
+        PassTiming& timing = out[i];
+        timing.name = pass.name;
+        timing.cpuAvgMs = 0.0;
+        timing.cpuMaxMs = 0.0;
+        timing.gpuAvgMs = 0.0;
+        timing.gpuMaxMs = 0.0;
+        for (int j = 0; j < pass.cpuCount; ++j) {
+            timing.cpuAvgMs += pass.cpuHistory[j];
+            timing.cpuMaxMs = std::max(timing.cpuMaxMs, pass.cpuHistory[j]);
+        }
+        for (int j = 0; j < pass.gpuCount; ++j) {
+            timing.gpuAvgMs += pass.gpuHistory[j];
+            timing.gpuMaxMs = std::max(timing.gpuMaxMs, pass.gpuHistory[j]);
+        }
+        if (pass.cpuCount > 0) {
+            timing.cpuAvgMs /= pass.cpuCount;
+        }
+        if (pass.gpuCount > 0) {
+            timing.gpuAvgMs /= pass.gpuCount;
+        }
+        timing.samples = pass.samples;
+        timing.skipped = pass.skipped;
+    }
+}
+
+void GpuProfiler::takeSamples(std::vector<GpuTimingSample>& out) {
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.swap(exportQueue_);
+}
+
+int64_t GpuProfiler::steadyMicros(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+TimingExport::TimingExport()
+    : file_(nullptr)
+{
+}
+
+TimingExport::~TimingExport() {
+    close();
+}
+
+bool TimingExport::open(const std::string& path) {
+    close();
+    file_ = std::fopen(path.c_str(), "w");
+    if (!file_) {
+        std::cerr << "Failed to open timing export file: " << path << std::endl;
+        return false;
+    }
+    std::fprintf(file_, "context,frame,pass,cpu_begin_us,cpu_ms,gpu_begin_us,gpu_end_us,gpu_ms\n");
+    std::cout << "Exporting per-pass timings to " << path << std::endl;
+    return true;
+}
+
+void TimingExport::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+void TimingExport::write(const char* context, const std::vector<GpuTimingSample>& samples) {
+    if (!file_) {
+        return;
+    }
+    for (const auto& sample : samples) {
+        std::fprintf(file_, "%s,%llu,%s,%lld,%.4f,%lld,%lld,%.4f\n",
+                     context, static_cast<unsigned long long>(sample.frame), sample.pass.c_str(),
+                     static_cast<long long>(sample.cpuBeginUs), sample.cpuMs,
+                     static_cast<long long>(sample.gpuBeginUs), static_cast<long long>(sample.gpuEndUs),
+                     sample.gpuMs);
+    }
+}
+
+} // namespace LiveText
@@ -0,0 +1,134 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace LiveText {
+
+// Rolling per-pass timings over the last HISTORY_FRAMES resolved samples
+struct PassTiming {
+    std::string name;
+    double cpuAvgMs = 0.0;
+    double cpuMaxMs = 0.0;
+    double gpuAvgMs = 0.0;
+    double gpuMaxMs = 0.0;
+    uint64_t samples = 0;       // GPU samples resolved since start
+    uint64_t skipped = 0;       // Frames with no free query slot (GPU more than QUERY_RING frames behind)
+};
+
+// One resolved pass, for offline analysis. Times are steady_clock microseconds,
+// with GPU timestamps mapped onto the same clock.
+struct GpuTimingSample {
+    uint64_t frame;
+    std::string pass;
+    int64_t cpuBeginUs;
+    double cpuMs;
+    int64_t gpuBeginUs;
+    int64_t gpuEndUs;
+    double gpuMs;
+};
+
+// GPU and CPU timing for the passes of one GL context. Each pass brackets its
+// commands with a pair of GL_TIMESTAMP queries from a ring of QUERY_RING
+// slots; results are collected at the start of later frames only once the
+// driver reports them available, so reading them never stalls the pipeline.
+// Query objects aren't shared between contexts - use one profiler per context.
+class GpuProfiler {
+public:
+    static constexpr int QUERY_RING = 4;
+    static constexpr int HISTORY_FRAMES = 120;
+
+    GpuProfiler();
+    ~GpuProfiler();
+
+    // Context must be current
+    bool initialize(const std::vector<std::string>& passNames);
+    void shutdown();
+
+    // Collect finished queries - call once per frame before the first pass
+    void beginFrame();
+    void beginPass(int pass);
+    void endPass(int pass);
+
+    void getTimings(std::vector<PassTiming>& out) const;
+
+    // Keep resolved samples for takeSamples() (off by default)
+    void setExportEnabled(bool enabled) { exportEnabled_ = enabled; }
+    // Any thread: move out samples resolved since the last call
+    void takeSamples(std::vector<GpuTimingSample>& out);
+
+private:
+    struct Slot {
+        GLuint beginQuery = 0;
+        GLuint endQuery = 0;
+        bool pending = false;
+        uint64_t frame = 0;
+        int64_t cpuBeginUs = 0;
+        double cpuMs = 0.0;
+    };
+
+    struct Pass {
+        std::string name;
+        std::array<Slot, QUERY_RING> slots;
+        int writeSlot = 0;          // Next slot to issue
+        int readSlot = 0;           // Oldest pending slot
+        bool active = false;        // Between beginPass and endPass with a GPU slot
+        std::chrono::steady_clock::time_point cpuBegin;
+        std::array<double, HISTORY_FRAMES> cpuHistory{};
+        std::array<double, HISTORY_FRAMES> gpuHistory{};
+        int cpuCount = 0;
+        int gpuCount = 0;
+        int cpuNext = 0;
+        int gpuNext = 0;
+        uint64_t samples = 0;
+        uint64_t skipped = 0;
+    };
+
+    bool initialized_;
+    std::vector<Pass> passes_;
+    uint64_t frame_;
+
+    // GPU clock -> steady_clock mapping, taken at initialize
+    int64_t gpuEpochNs_;
+    int64_t cpuEpochUs_;
+
+    bool exportEnabled_;
+    mutable std::mutex mutex_;  // Guards timings read by the UI and the export queue
+    std::vector<GpuTimingSample> exportQueue_;
+
+    void collect(Pass& pass);
+    static int64_t steadyMicros(std::chrono::steady_clock::time_point time);
+};
+
+// Writes GpuTimingSample rows as CSV. File I/O belongs on a thread that isn't
+// pacing output - the receiver drains its profilers from the UI thread.
+class TimingExport {
+public:
+    TimingExport();
+    ~TimingExport();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file_ != nullptr; }
+
+    // context labels the profiler the samples came from, e.g. "render" or "dashboard"
+    void write(const char* context, const std::vector<GpuTimingSample>& samples);
+
+private:
+    FILE* file_;
+};
+
+} // namespace LiveText
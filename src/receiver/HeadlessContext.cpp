@@ -0,0 +1,208 @@
+#include "HeadlessContext.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef ENABLE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl3w.h>
+#endif
+
+namespace LiveText {
+
+HeadlessContext::HeadlessContext()
+    : initialized_(false)
+    , display_(nullptr)
+    , context_(nullptr)
+    , surface_(nullptr)
+{
+}
+
+HeadlessContext::~HeadlessContext() {
+    shutdown();
+}
+
+#ifdef ENABLE_EGL
+
+namespace {
+
+bool hasExtension(const char* extensions, const char* name) {
+    if (!extensions) {
+        return false;
+    }
+    size_t length = std::strlen(name);
+    const char* p = extensions;
+    while ((p = std::strstr(p, name)) != nullptr) {
+        if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) {
+            return true;
+        }
+        p += length;
+    }
+    return false;
+}
+
+GL3WglProc loadProc(const char* name) {
+    return reinterpret_cast<GL3WglProc>(eglGetProcAddress(name));
+}
+
+} // namespace
+
+bool HeadlessContext::isAvailable() {
+    return true;
+}
+
+bool HeadlessContext::initialize() {
+    if (initialized_) {
+        return true;
+    }
+
+    // Prefer Mesa's surfaceless platform - it needs no X11/Wayland/GBM device at all
+    EGLDisplay display = EGL_NO_DISPLAY;
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        std::cerr << "Failed to initialize EGL display" << std::endl;
+        return false;
+    }
+    display_ = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "EGL implementation does not support desktop OpenGL" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    bool surfaceless = hasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+        std::cerr << "No suitable EGL config for offscreen rendering" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    // Same context the windowed receiver asks GLFW for
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT) {
+        std::cerr << "Failed to create OpenGL 3.3 core EGL context (error 0x"
+                  << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        shutdown();
+        return false;
+    }
+    context_ = context;
+
+    if (!surfaceless) {
+        const EGLint pbufferAttribs[] = {EGL_WIDTH, 16, EGL_HEIGHT, 16, EGL_NONE};
+        EGLSurface surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        if (surface == EGL_NO_SURFACE) {
+            std::cerr << "Failed to create EGL pbuffer surface" << std::endl;
+            shutdown();
+            return false;
+        }
+        surface_ = surface;
+    }
+
+    if (!makeCurrent()) {
+        std::cerr << "Failed to make EGL context current" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    if (gl3wInit2(loadProc) != 0) {
+        std::cerr << "Failed to load OpenGL functions through EGL" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    description_ = std::string("EGL ") + std::to_string(major) + "." + std::to_string(minor) +
+                   (surfaceless ? " surfaceless" : " pbuffer");
+    initialized_ = true;
+    std::cout << "Headless OpenGL context created: " << description_ << std::endl;
+    return true;
+}
+
+void HeadlessContext::shutdown() {
+    if (display_) {
+        EGLDisplay display = static_cast<EGLDisplay>(display_);
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surface_) {
+            eglDestroySurface(display, static_cast<EGLSurface>(surface_));
+            surface_ = nullptr;
+        }
+        if (context_) {
+            eglDestroyContext(display, static_cast<EGLContext>(context_));
+            context_ = nullptr;
+        }
+        eglTerminate(display);
+        display_ = nullptr;
+    }
+    initialized_ = false;
+}
+
+bool HeadlessContext::makeCurrent() {
+    if (!display_ || !context_) {
+        return false;
+    }
+    EGLSurface surface = surface_ ? static_cast<EGLSurface>(surface_) : EGL_NO_SURFACE;
+    return eglMakeCurrent(static_cast<EGLDisplay>(display_), surface, surface,
+                          static_cast<EGLContext>(context_)) == EGL_TRUE;
+}
+
+void HeadlessContext::releaseCurrent() {
+    if (display_) {
+        eglMakeCurrent(static_cast<EGLDisplay>(display_), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+}
+
+#else
+
+bool HeadlessContext::isAvailable() {
+    return false;
+}
+
+bool HeadlessContext::initialize() {
+    std::cerr << "Headless context requires EGL - rebuild with EGL available" << std::endl;
+    return false;
+}
+
+void HeadlessContext::shutdown() {
+    initialized_ = false;
+}
+
+bool HeadlessContext::makeCurrent() {
+    return false;
+}
+
+void HeadlessContext::releaseCurrent() {
+}
+
+#endif
+
+} // namespace LiveText
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+// Use void pointers to keep EGL headers out of the app
+typedef void* EGLDisplayPtr;
+typedef void* EGLContextPtr;
+typedef void* EGLSurfacePtr;
+
+namespace LiveText {
+
+// Offscreen OpenGL 3.3 core context for running the receiver without a display.
+// Uses EGL: a surfaceless context where EGL_KHR_surfaceless_context is
+// available (Mesa, NVIDIA), otherwise a tiny pbuffer. All rendering goes to
+// the text renderer's FBOs, so the surface is never drawn to.
+class HeadlessContext {
+public:
+    HeadlessContext();
+    ~HeadlessContext();
+
+    bool initialize();
+    void shutdown();
+
+    bool isInitialized() const { return initialized_; }
+    bool makeCurrent();
+    void releaseCurrent();  // Unbind from the calling thread so another thread can make it current
+    std::string getDescription() const { return description_; }
+
+    // False when built without EGL (ENABLE_EGL) - callers fall back to a hidden window
+    static bool isAvailable();
+
+private:
+    bool initialized_;
+    std::string description_;
+
+    EGLDisplayPtr display_;
+    EGLContextPtr context_;
+    EGLSurfacePtr surface_;  // EGL_NO_SURFACE when surfaceless
+};
+
+} // namespace LiveText
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include "common/TextMessage.h"
+
+namespace LiveText {
+
+// Hands network messages from the subscriber threads to the render thread
+// without locks. post() pushes onto an atomic stack from any number of
+// network threads; drain() on the render thread takes the whole stack in one
+// exchange and returns the messages in arrival order.
+class MessageMailbox {
+public:
+    struct Entry {
+        TextMessage message;
+        int feedId;
+    };
+
+    MessageMailbox() : head_(nullptr) {}
+
+    ~MessageMailbox() {
+        Node* node = head_.exchange(nullptr);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    MessageMailbox(const MessageMailbox&) = delete;
+    MessageMailbox& operator=(const MessageMailbox&) = delete;
+
+    void post(const TextMessage& message, int feedId) {
+        Node* node = new Node{{message, feedId}, head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Replaces the contents of out with the pending messages, oldest first
+    void drain(std::vector<Entry>& out) {
+        out.clear();
+        Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+
+        // The stack is newest-first - reverse it so messages apply in order
+        Node* reversed = nullptr;
+        while (node) {
+            Node* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+        while (reversed) {
+            Node* next = reversed->next;
+            out.push_back(reversed->entry);
+            delete reversed;
+            reversed = next;
+        }
+    }
+
+private:
+    struct Node {
+        Entry entry;
+        Node* next;
+    };
+
+    std::atomic<Node*> head_;
+};
+
+} // namespace LiveText
@@ -0,0 +1,237 @@
+#include "OutputSwapChain.h"
+#include <iostream>
+
+namespace LiveText {
+
+OutputSwapChain::OutputSwapChain()
+    : width_(0)
+    , height_(0)
+    , backBuffer_(-1)
+    , latestBuffer_(-1)
+    , frameCounter_(0)
+    , skippedFrames_(0)
+{
+}
+
+OutputSwapChain::~OutputSwapChain() {
+    shutdown();
+}
+
+bool OutputSwapChain::initialize(int width, int height) {
+    width_ = width;
+    height_ = height;
+
+    for (auto& buffer : buffers_) {
+        if (!createBuffer(buffer)) {
+            shutdown();
+            return false;
+        }
+    }
+
+    backBuffer_ = -1;
+    latestBuffer_ = -1;
+    std::cout << "Output swap chain initialized: " << BUFFER_COUNT << " x "
+              << width_ << "x" << height_ << std::endl;
+    return true;
+}
+
+void OutputSwapChain::shutdown() {
+    for (auto& buffer : buffers_) {
+        destroyBuffer(buffer);
+    }
+    for (auto& consumer : consumers_) {
+        consumer.heldBuffer = -1;
+    }
+    backBuffer_ = -1;
+    latestBuffer_ = -1;
+}
+
+bool OutputSwapChain::resize(int width, int height) {
+    if (width == width_ && height == height_) {
+        return true;
+    }
+
+    // Consumers must re-acquire after a resize; their held textures are gone
+    shutdown();
+    return initialize(width, height);
+}
+
+GLuint OutputSwapChain::acquireBackBuffer() {
+    // Prefer the oldest buffer that is neither the latest frame nor held by a consumer
+    int candidate = -1;
+    for (int i = 0; i < BUFFER_COUNT; ++i) {
+        if (i == latestBuffer_ || buffers_[i].holders > 0) {
+            continue;
+        }
+        if (candidate < 0 || buffers_[i].frameNumber < buffers_[candidate].frameNumber) {
+            candidate = i;
+        }
+    }
+
+    // Every spare buffer is held - drawing into one would tear the frame its consumer is reading,
+    // so skip this frame; the outputs keep the latest one
+    if (candidate < 0) {
+        skippedFrames_++;
+        backBuffer_ = -1;
+        return 0;
+    }
+
+    Buffer& buffer = buffers_[candidate];
+
+    // Order our writes after any outstanding consumer reads (GPU-side wait only)
+    if (buffer.releaseFence) {
+        glWaitSync(buffer.releaseFence, 0, GL_TIMEOUT_IGNORED);
+        deleteFence(buffer.releaseFence);
+    }
+    deleteFence(buffer.renderFence);
+
+    backBuffer_ = candidate;
+    return buffer.frameBuffer;
+}
+
+void OutputSwapChain::present() {
+    if (backBuffer_ < 0) {
+        return;
+    }
+
+    Buffer& buffer = buffers_[backBuffer_];
+    buffer.renderFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    buffer.frameNumber = ++frameCounter_;
+
+    latestBuffer_ = backBuffer_;
+    backBuffer_ = -1;
+}
+
+int OutputSwapChain::registerConsumer(const std::string& name) {
+    Consumer consumer;
+    consumer.name = name;
+    consumer.lastFrameNumber = frameCounter_;
+    consumers_.push_back(consumer);
+    return static_cast<int>(consumers_.size()) - 1;
+}
+
+OutputSwapChain::Frame OutputSwapChain::acquireLatest(int consumerId) {
+    Frame frame;
+    if (consumerId < 0 || consumerId >= static_cast<int>(consumers_.size())) {
+        return frame;
+    }
+
+    Consumer& consumer = consumers_[consumerId];
+    if (consumer.heldBuffer >= 0) {
+        release(consumerId);
+    }
+
+    if (latestBuffer_ < 0) {
+        return frame;
+    }
+
+    Buffer& buffer = buffers_[latestBuffer_];
+    if (buffer.renderFence) {
+        glWaitSync(buffer.renderFence, 0, GL_TIMEOUT_IGNORED);
+    }
+
+    buffer.holders++;
+    consumer.heldBuffer = latestBuffer_;
+
+    // Frame accounting relative to what this output saw last time
+    if (buffer.frameNumber == consumer.lastFrameNumber) {
+        consumer.stats.duplicatedFrames++;
+    } else if (buffer.frameNumber > consumer.lastFrameNumber + 1) {
+        consumer.stats.droppedFrames += buffer.frameNumber - consumer.lastFrameNumber - 1;
+    }
+    consumer.lastFrameNumber = buffer.frameNumber;
+    consumer.stats.framesConsumed++;
+
+    frame.texture = buffer.colorTexture;
+    frame.frameNumber = buffer.frameNumber;
+    return frame;
+}
+
+void OutputSwapChain::release(int consumerId) {
+    if (consumerId < 0 || consumerId >= static_cast<int>(consumers_.size())) {
+        return;
+    }
+
+    Consumer& consumer = consumers_[consumerId];
+    if (consumer.heldBuffer < 0) {
+        return;
+    }
+
+    Buffer& buffer = buffers_[consumer.heldBuffer];
+    if (buffer.holders > 0) {
+        buffer.holders--;
+    }
+
+    // Fence the consumer's reads so the renderer can order its next write after them
+    deleteFence(buffer.releaseFence);
+    buffer.releaseFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    consumer.heldBuffer = -1;
+}
+
+SwapChainStats OutputSwapChain::getStats(int consumerId) const {
+    SwapChainStats stats;
+    if (consumerId >= 0 && consumerId < static_cast<int>(consumers_.size())) {
+        stats = consumers_[consumerId].stats;
+    }
+    stats.framesPresented = frameCounter_;
+    stats.skippedFrames = skippedFrames_;
+    return stats;
+}
+
+GLuint OutputSwapChain::getLatestTexture() const {
+    return latestBuffer_ >= 0 ? buffers_[latestBuffer_].colorTexture : 0;
+}
+
+bool OutputSwapChain::createBuffer(Buffer& buffer) {
+    glGenFramebuffers(1, &buffer.frameBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, buffer.frameBuffer);
+
+    // Color only - text rendering never uses depth testing
+    glGenTextures(1, &buffer.colorTexture);
+    glBindTexture(GL_TEXTURE_2D, buffer.colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, buffer.colorTexture, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (complete) {
+        // Start out transparent so an early consumer never sees garbage
+        glViewport(0, 0, width_, height_);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    } else {
+        std::cerr << "Swap chain framebuffer not complete!" << std::endl;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    buffer.frameNumber = 0;
+    buffer.holders = 0;
+    return complete;
+}
+
+void OutputSwapChain::destroyBuffer(Buffer& buffer) {
+    deleteFence(buffer.renderFence);
+    deleteFence(buffer.releaseFence);
+    if (buffer.frameBuffer) {
+        glDeleteFramebuffers(1, &buffer.frameBuffer);
+        buffer.frameBuffer = 0;
+    }
+    if (buffer.colorTexture) {
+        glDeleteTextures(1, &buffer.colorTexture);
+        buffer.colorTexture = 0;
+    }
+    buffer.frameNumber = 0;
+    buffer.holders = 0;
+}
+
+void OutputSwapChain::deleteFence(GLsync& fence) {
+    if (fence) {
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+} // namespace LiveText
@@ -0,0 +1,100 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LiveText {
+
+struct SwapChainStats {
+    uint64_t framesPresented = 0;   // Frames completed by the renderer
+    uint64_t framesConsumed = 0;    // Frames handed to this output
+    uint64_t droppedFrames = 0;     // Completed frames this output never saw
+    uint64_t duplicatedFrames = 0;  // Times this output was handed the same frame again
+    uint64_t skippedFrames = 0;     // Frames not rendered because every spare buffer was held
+};
+
+// Ring of output framebuffers shared between the text renderer (producer) and
+// the texture senders (consumers). The renderer always draws into a buffer that
+// no consumer is holding, and consumers always get the most recently completed
+// frame, so neither side ever waits for the other.
+//
+// BUFFER_COUNT must be greater than the number of consumers that can hold a
+// frame at the same time plus one (the latest frame). If every spare buffer
+// is held anyway, the renderer skips the frame rather than drawing over one
+// that a consumer is still reading. Skipped frames are counted in the stats.
+class OutputSwapChain {
+public:
+    static constexpr int BUFFER_COUNT = 3;
+
+    struct Frame {
+        GLuint texture = 0;
+        uint64_t frameNumber = 0;
+    };
+
+    OutputSwapChain();
+    ~OutputSwapChain();
+
+    bool initialize(int width, int height);
+    void shutdown();
+    bool resize(int width, int height);
+
+    // Producer side: acquire a free buffer, render into its framebuffer, present it.
+    // Returns 0 if every spare buffer is held - skip the frame.
+    GLuint acquireBackBuffer();
+    void present();
+
+    // Consumer side: one id per output, acquire/release around each send.
+    int registerConsumer(const std::string& name);
+    Frame acquireLatest(int consumerId);
+    void release(int consumerId);
+
+    SwapChainStats getStats(int consumerId) const;
+    const std::string& getConsumerName(int consumerId) const { return consumers_[consumerId].name; }
+    int getConsumerCount() const { return static_cast<int>(consumers_.size()); }
+
+    GLuint getLatestTexture() const;
+    uint64_t getFrameNumber() const { return frameCounter_; }
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+
+private:
+    struct Buffer {
+        GLuint frameBuffer = 0;
+        GLuint colorTexture = 0;
+        uint64_t frameNumber = 0;
+        GLsync renderFence = nullptr;   // Signalled when rendering into this buffer completes
+        GLsync releaseFence = nullptr;  // Signalled when the last consumer read completes
+        int holders = 0;                // Consumers currently holding this buffer
+    };
+
+    struct Consumer {
+        std::string name;
+        int heldBuffer = -1;
+        uint64_t lastFrameNumber = 0;
+        SwapChainStats stats;
+    };
+
+    std::array<Buffer, BUFFER_COUNT> buffers_;
+    std::vector<Consumer> consumers_;
+    int width_, height_;
+    int backBuffer_;    // Buffer currently being rendered, -1 if none
+    int latestBuffer_;  // Most recently presented buffer, -1 before the first frame
+    uint64_t frameCounter_;
+    uint64_t skippedFrames_;
+
+    bool createBuffer(Buffer& buffer);
+    void destroyBuffer(Buffer& buffer);
+    static void deleteFence(GLsync& fence);
+};
+
+} // namespace LiveText
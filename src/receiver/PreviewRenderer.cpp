@@ -0,0 +1,209 @@
+#include "PreviewRenderer.h"
+#include <iostream>
+
+namespace LiveText {
+
+PreviewRenderer::PreviewRenderer()
+    : sourceWidth_(0)
+    , sourceHeight_(0)
+    , readFrameBuffer_(0)
+    , readyIndex_(-1)
+    , pendingIndex_(-1)
+    , pendingFence_(nullptr)
+    , updateRate_(0.0)
+    , updateCount_(0)
+{
+}
+
+PreviewRenderer::~PreviewRenderer() {
+    shutdown();
+}
+
+bool PreviewRenderer::initialize(int sourceWidth, int sourceHeight, int previewWidth) {
+    shutdown();
+
+    if (previewWidth <= 0 || previewWidth > sourceWidth) {
+        previewWidth = sourceWidth;
+    }
+    sourceWidth_ = sourceWidth;
+    sourceHeight_ = sourceHeight;
+
+    // Halve while the next step is still at least the preview size; the last size is the output
+    std::vector<std::pair<int, int>> sizes;
+    int width = sourceWidth;
+    int height = sourceHeight;
+    while (width / 2 >= previewWidth) {
+        width /= 2;
+        height /= 2;
+        sizes.emplace_back(width, height);
+    }
+    if (width != previewWidth) {
+        int previewHeight = static_cast<int>(static_cast<int64_t>(previewWidth) * sourceHeight / sourceWidth);
+        sizes.emplace_back(previewWidth, previewHeight);
+    }
+    if (sizes.empty()) {
+        sizes.emplace_back(sourceWidth, sourceHeight);
+    }
+
+    for (size_t i = 0; i + 1 < sizes.size(); ++i) {
+        Level level;
+        if (!createLevel(level, sizes[i].first, sizes[i].second)) {
+            destroyLevel(level);
+            shutdown();
+            return false;
+        }
+        levels_.push_back(level);
+    }
+    for (auto& output : outputs_) {
+        if (!createLevel(output, sizes.back().first, sizes.back().second)) {
+            shutdown();
+            return false;
+        }
+    }
+
+    glGenFramebuffers(1, &readFrameBuffer_);
+    lastUpdate_ = std::chrono::steady_clock::time_point();
+
+    std::cout << "Preview initialized: " << getWidth() << "x" << getHeight()
+              << " (" << sizes.size() << " downscale passes)" << std::endl;
+    return true;
+}
+
+bool PreviewRenderer::createLevel(Level& level, int width, int height) {
+    level.width = width;
+    level.height = height;
+
+    glGenTextures(1, &level.texture);
+    glBindTexture(GL_TEXTURE_2D, level.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &level.frameBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, level.frameBuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, level.texture, 0);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        std::cerr << "Preview framebuffer " << width << "x" << height << " is not complete" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void PreviewRenderer::destroyLevel(Level& level) {
+    if (level.frameBuffer) {
+        glDeleteFramebuffers(1, &level.frameBuffer);
+        level.frameBuffer = 0;
+    }
+    if (level.texture) {
+        glDeleteTextures(1, &level.texture);
+        level.texture = 0;
+    }
+}
+
+void PreviewRenderer::shutdown() {
+    if (pendingFence_) {
+        glDeleteSync(pendingFence_);
+        pendingFence_ = nullptr;
+    }
+    for (auto& level : levels_) {
+        destroyLevel(level);
+    }
+    levels_.clear();
+    for (auto& output : outputs_) {
+        destroyLevel(output);
+    }
+    readyIndex_ = -1;
+    pendingIndex_ = -1;
+
+    if (readFrameBuffer_) {
+        glDeleteFramebuffers(1, &readFrameBuffer_);
+        readFrameBuffer_ = 0;
+    }
+}
+
+void PreviewRenderer::setUpdateRate(double fps) {
+    updateRate_ = fps > 0.0 ? fps : 0.0;
+}
+
+bool PreviewRenderer::isDue() const {
+    // Never overwrite an output whose previous blit hasn't been promoted yet
+    if (outputs_[0].texture == 0 || updateRate_ <= 0.0 || pendingFence_) {
+        return false;
+    }
+    auto interval = std::chrono::duration<double>(1.0 / updateRate_);
+    return std::chrono::steady_clock::now() - lastUpdate_ >= interval;
+}
+
+void PreviewRenderer::update(GLuint sourceTexture) {
+    if (outputs_[0].texture == 0 || sourceTexture == 0 || pendingFence_) {
+        return;
+    }
+
+    // Oldest output: not the one on display, and nothing is pending
+    int target = (readyIndex_ + 1) % OUTPUT_COUNT;
+
+    GLint previousReadFrameBuffer = 0;
+    GLint previousDrawFrameBuffer = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadFrameBuffer);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousDrawFrameBuffer);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFrameBuffer_);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, sourceTexture, 0);
+
+    int sourceWidth = sourceWidth_;
+    int sourceHeight = sourceHeight_;
+    for (const auto& level : levels_) {
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, level.frameBuffer);
+        glBlitFramebuffer(0, 0, sourceWidth, sourceHeight,
+                          0, 0, level.width, level.height,
+                          GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+        // Next pass reads from the level just written
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, level.frameBuffer);
+        sourceWidth = level.width;
+        sourceHeight = level.height;
+    }
+
+    const Level& output = outputs_[target];
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, output.frameBuffer);
+    glBlitFramebuffer(0, 0, sourceWidth, sourceHeight,
+                      0, 0, output.width, output.height,
+                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+    // Detach so the source texture isn't kept attached to our read framebuffer
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFrameBuffer_);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previousReadFrameBuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousDrawFrameBuffer);
+
+    pendingIndex_ = target;
+    pendingFence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+
+    lastUpdate_ = std::chrono::steady_clock::now();
+    updateCount_++;
+}
+
+void PreviewRenderer::poll() {
+    if (!pendingFence_) {
+        return;
+    }
+    GLenum result = glClientWaitSync(pendingFence_, 0, 0);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+        glDeleteSync(pendingFence_);
+        pendingFence_ = nullptr;
+        readyIndex_ = pendingIndex_;
+        pendingIndex_ = -1;
+    }
+}
+
+} // namespace LiveText
@@ -0,0 +1,76 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace LiveText {
+
+// Operator preview of the actual output: a downscaled copy of the text
+// renderer's output texture, refreshed at a throttled rate. The downscale is
+// a chain of 2:1 linear blits (each one a 2x2 box filter) followed by a final
+// blit to the preview size, so thin strokes survive the 4K -> preview step.
+//
+// Runs on the render thread; the dashboard samples getTexture() from a
+// shared context. Final images rotate through OUTPUT_COUNT textures and only
+// one whose blit has completed on the GPU is ever handed out.
+class PreviewRenderer {
+public:
+    static constexpr int OUTPUT_COUNT = 3;
+
+    PreviewRenderer();
+    ~PreviewRenderer();
+
+    bool initialize(int sourceWidth, int sourceHeight, int previewWidth);
+    void shutdown();
+
+    // 0 disables updates
+    void setUpdateRate(double fps);
+    bool isDue() const;
+
+    // Render thread: copy sourceTexture (sourceWidth x sourceHeight) into the next output
+    void update(GLuint sourceTexture);
+    // Render thread: promote the last update once its blit has finished
+    void poll();
+
+    GLuint getTexture() const { return readyIndex_ >= 0 ? outputs_[readyIndex_].texture : 0; }
+    int getWidth() const { return outputs_[0].width; }
+    int getHeight() const { return outputs_[0].height; }
+    uint64_t getUpdateCount() const { return updateCount_; }
+    double getUpdateRate() const { return updateRate_; }
+
+private:
+    struct Level {
+        GLuint texture = 0;
+        GLuint frameBuffer = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    int sourceWidth_, sourceHeight_;
+    std::vector<Level> levels_;                   // Intermediate 2:1 steps
+    std::array<Level, OUTPUT_COUNT> outputs_;     // Final preview-size images
+    GLuint readFrameBuffer_;
+
+    int readyIndex_;     // Newest completed output, -1 before the first
+    int pendingIndex_;   // Output being written, -1 if none
+    GLsync pendingFence_;
+
+    double updateRate_;
+    std::chrono::steady_clock::time_point lastUpdate_;
+    uint64_t updateCount_;
+
+    static bool createLevel(Level& level, int width, int height);
+    static void destroyLevel(Level& level);
+};
+
+} // namespace LiveText
@@ -3,22 +3,21 @@
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
-#include <sstream>
+#include <thread>
 #include <vector>
 
 namespace LiveText {
 
-ReceiverApp::ReceiverApp()
-    : window_(nullptr)
+ReceiverApp::ReceiverApp(const ReceiverConfig& config)
+    : config_(config)
+    , window_(nullptr)
+    , renderWindow_(nullptr)
+    , imguiInitialized_(false)
     , running_(false)
-    , currentSize_(TextSize::SMALL)
-    , needsClearOldOutput_(false)
-    , outputToClear_(TextSize::SMALL)
-    , needsClearInactiveAfterFade_(false)
-    , isFading_(false)
-    , fadeAlpha_(1.0f)
-    , blankTexture_(0)
 {
 }
 
@@ -27,17 +26,86 @@ ReceiverApp::~ReceiverApp() {
 }
 
 bool ReceiverApp::initialize() {
+    if (config_.headless) {
+        if (!initializeHeadless()) {
+            return false;
+        }
+    } else {
+        if (!initializeWindow()) {
+            return false;
+        }
+    }
+
+    std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
+
+    // Initialize components
+    healthMonitor_ = std::make_unique<HealthMonitor>();
+
+    // Output pipeline resources are created on the render context, which is current here
+    renderThread_ = std::make_unique<RenderThread>(config_);
+    if (!renderThread_->initialize(SYPHON_WIDTH, SYPHON_HEIGHT, !config_.headless)) {
+        return false;
+    }
+
+    // Dashboard runs on the UI window's own context
+    if (!config_.headless) {
+        glfwMakeContextCurrent(window_);
+        initializeImGui();
+        if (dashboardProfiler_.initialize({"ImGui"})) {
+            dashboardProfiler_.setExportEnabled(!config_.timingExportPath.empty());
+        }
+    }
+
+    if (!config_.timingExportPath.empty()) {
+        timingExport_.open(config_.timingExportPath);
+    }
+
+    // Fit reports and state requests are advisory - the receiver runs without them
+    feedbackPublisher_ = std::make_unique<AeronPublisher>(FEEDBACK_CHANNEL, FEEDBACK_STREAM_ID);
+    if (feedbackPublisher_->initialize()) {
+        AeronPublisher* feedback = feedbackPublisher_.get();
+        renderThread_->setFeedbackCallback([feedback](const TextMessage& report) {
+            feedback->publish(report);
+        });
+    } else {
+        std::cerr << "Failed to initialize feedback publisher - sender will not see fit reports" << std::endl;
+    }
+
+    // Initialize Aeron subscriber
+    std::vector<std::string> channels = {PRIMARY_CHANNEL, SECONDARY_CHANNEL};
+    subscriber_ = std::make_unique<AeronSubscriber>(channels, STREAM_ID);
+
+    if (!subscriber_->initialize()) {
+        std::cerr << "Failed to initialize Aeron subscriber" << std::endl;
+        return false;
+    }
+
+    // Set message callback
+    subscriber_->setMessageCallback([this](const TextMessage& message, int feedId) {
+        onMessageReceived(message, feedId);
+    });
+
+    // Start subscriber
+    subscriber_->start();
+
+    running_ = true;
+    std::cout << "Live Text Receiver initialized successfully" << std::endl;
+    std::cout << "Listening for messages on dual Aeron feeds..." << std::endl;
+
+    return true;
+}
+
+bool ReceiverApp::initializeWindow() {
     // Initialize GLFW
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW" << std::endl;
         return false;
     }
 
-    // Create window (hidden for headless rendering)
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE); // Visible window for GUI display
+    glfwWindowHint(GLFW_VISIBLE, config_.headless ? GLFW_FALSE : GLFW_TRUE);
 
     window_ = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Live Text Receiver", nullptr, nullptr);
     if (!window_) {
@@ -46,157 +114,207 @@ bool ReceiverApp::initialize() {
         return false;
     }
 
+    // Render thread context: a hidden window sharing objects with the UI window.
+    // In headless mode the (hidden) main window is the render context itself.
+    if (!config_.headless) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        renderWindow_ = glfwCreateWindow(16, 16, "Live Text Render", nullptr, window_);
+        if (!renderWindow_) {
+            std::cerr << "Failed to create shared render context" << std::endl;
+            return false;
+        }
+    }
+
     glfwMakeContextCurrent(window_);
-    glfwSwapInterval(1); // Enable vsync
+    glfwSwapInterval(0); // Dashboard is paced by DASHBOARD_FPS; outputs by the frame scheduler
+
+    if (gl3wInit() != 0) {
+        std::cerr << "Failed to load OpenGL functions" << std::endl;
+        return false;
+    }
 
     // Set callbacks
     glfwSetWindowUserPointer(window_, this);
     glfwSetFramebufferSizeCallback(window_, framebufferSizeCallback);
     glfwSetKeyCallback(window_, keyCallback);
 
-    // OpenGL context already initialized by GLFW
+    // Leave the render context current for RenderThread::initialize
+    if (renderWindow_) {
+        glfwMakeContextCurrent(renderWindow_);
+    }
 
-    std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
+    return true;
+}
+
+bool ReceiverApp::initializeHeadless() {
+    if (HeadlessContext::isAvailable()) {
+        headlessContext_ = std::make_unique<HeadlessContext>();
+        if (headlessContext_->initialize()) {
+            return true;
+        }
+        headlessContext_.reset();
+        std::cerr << "EGL headless context unavailable - falling back to a hidden window" << std::endl;
+    }
+
+    // No EGL (e.g. macOS): an invisible GLFW window still skips ImGui and presentation
+    return initializeWindow();
+}
 
-    // Initialize ImGui
+void ReceiverApp::initializeImGui() {
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
     io.IniFilename = nullptr; // Disable .ini file
 
-    // Load fonts - match sender's font configuration
-    std::string fontPath = "fonts/ABF.ttf";
-
-    // Add default font first (system font)
+    // Only the status text uses ImGui fonts - the output preview is a texture
     io.Fonts->AddFontDefault();
 
-    // Add ABF font at small size (48px native) - index 1
-    io.Fonts->AddFontFromFileTTF(fontPath.c_str(), 48.0f);
-
-    // Add ABF font at big size (160px native) - index 2
-    io.Fonts->AddFontFromFileTTF(fontPath.c_str(), 160.0f);
-
     // Setup ImGui style
     ImGui::StyleColorsDark();
 
     // Initialize ImGui backends
     ImGui_ImplGlfw_InitForOpenGL(window_, true);
     ImGui_ImplOpenGL3_Init("#version 330");
+    imguiInitialized_ = true;
 
-    std::cout << "ImGui initialized for receiver GUI with ABF font" << std::endl;
-
-    // Initialize components
-    healthMonitor_ = std::make_unique<HealthMonitor>();
+    std::cout << "ImGui initialized for receiver GUI" << std::endl;
+}
 
-    // Initialize text renderer at 4K resolution for Syphon outputs
-    textRenderer_ = std::make_unique<TextRenderer>();
-    if (!textRenderer_->initialize(SYPHON_WIDTH, SYPHON_HEIGHT)) {
-        std::cerr << "Failed to initialize text renderer" << std::endl;
-        return false;
+void ReceiverApp::startRenderThread() {
+    // A context can only be current on one thread - hand the render context over
+    if (headlessContext_) {
+        headlessContext_->releaseCurrent();
+        HeadlessContext* context = headlessContext_.get();
+        renderThread_->start([context] { context->makeCurrent(); },
+                             [context] { context->releaseCurrent(); });
+    } else {
+        GLFWwindow* renderWindow = renderWindow_ ? renderWindow_ : window_;
+        if (!renderWindow_) {
+            glfwMakeContextCurrent(nullptr);
+        }
+        renderThread_->start([renderWindow] { glfwMakeContextCurrent(renderWindow); },
+                             [] { glfwMakeContextCurrent(nullptr); });
     }
+}
 
-    // Initialize texture senders (Spout on Windows, Syphon on macOS) at 4K resolution
-    // Small text output
-    textureSenderSmall_ = std::make_unique<TextureSender>();
-    if (!textureSenderSmall_->initialize("LiveText-Small", SYPHON_WIDTH, SYPHON_HEIGHT)) {
-        std::cerr << "Failed to initialize small texture sender" << std::endl;
-        return false;
-    }
-    std::cout << "Small text output initialized (4K): " << textureSenderSmall_->getPlatformInfo() << std::endl;
+void ReceiverApp::run() {
+    startRenderThread();
 
-    // Big text output
-    textureSenderBig_ = std::make_unique<TextureSender>();
-    if (!textureSenderBig_->initialize("LiveText-Big", SYPHON_WIDTH, SYPHON_HEIGHT)) {
-        std::cerr << "Failed to initialize big texture sender" << std::endl;
-        return false;
-    }
-    std::cout << "Big text output initialized (4K): " << textureSenderBig_->getPlatformInfo() << std::endl;
+    auto lastStatus = std::chrono::steady_clock::now();
+    auto dashboardInterval = std::chrono::duration<double>(1.0 / DASHBOARD_FPS);
 
-    // Create a blank texture for clearing inactive outputs
-    glGenTextures(1, &blankTexture_);
-    glBindTexture(GL_TEXTURE_2D, blankTexture_);
-    std::vector<unsigned char> blankData(SYPHON_WIDTH * SYPHON_HEIGHT * 4, 0);  // RGBA all zeros (transparent black)
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, SYPHON_WIDTH, SYPHON_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, blankData.data());
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    std::cout << "Blank texture created for clearing inactive outputs" << std::endl;
+    // The UI thread only shows status - output frames never wait on it
+    while (running_ && !renderThread_->isFinished() && !(window_ && glfwWindowShouldClose(window_))) {
+        renderThread_->updateStatus();
+        updateHealthMonitoring();
+        exportTimings();
 
-    // Initialize Aeron subscriber
-    std::vector<std::string> channels = {PRIMARY_CHANNEL, SECONDARY_CHANNEL};
-    subscriber_ = std::make_unique<AeronSubscriber>(channels, STREAM_ID);
+        if (imguiInitialized_) {
+            auto frameStart = std::chrono::steady_clock::now();
+            glfwPollEvents();
+            renderDashboard();
+            std::this_thread::sleep_until(frameStart + dashboardInterval);
+        } else {
+            if (window_) {
+                glfwPollEvents();
+            }
 
-    if (!subscriber_->initialize()) {
-        std::cerr << "Failed to initialize Aeron subscriber" << std::endl;
-        return false;
+            // No dashboard in headless mode - print timing to the console instead
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastStatus >= std::chrono::seconds(HEADLESS_STATUS_INTERVAL_SECONDS)) {
+                printStatus();
+                lastStatus = now;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
     }
 
-    // Set message callback
-    subscriber_->setMessageCallback([this](const TextMessage& message, int feedId) {
-        onMessageReceived(message, feedId);
-    });
-
-    // Start subscriber
-    subscriber_->start();
-
-    running_ = true;
-    std::cout << "Live Text Receiver initialized successfully" << std::endl;
-    std::cout << "Listening for messages on dual Aeron feeds..." << std::endl;
-
-    return true;
+    renderThread_->stop();
+    exportTimings();
 }
 
-void ReceiverApp::run() {
-    while (running_ && !glfwWindowShouldClose(window_)) {
-        glfwPollEvents();
-
-        // Update health monitoring and fade animation
-        updateHealthMonitoring();
-        updateFade();
-
-        // Render frame
-        render();
+void ReceiverApp::exportTimings() {
+    if (!timingExport_.isOpen()) {
+        return;
+    }
+    renderThread_->takeTimingSamples(timingSamples_);
+    timingExport_.write("render", timingSamples_);
+    dashboardProfiler_.takeSamples(timingSamples_);
+    timingExport_.write("dashboard", timingSamples_);
+}
 
-        // Small delay to prevent excessive CPU usage
-        std::this_thread::sleep_for(std::chrono::milliseconds(16)); // ~60 FPS
+void ReceiverApp::printStatus() const {
+    const RenderStatus& status = renderThread_->getStatus();
+    if (status.framesRendered == 0) {
+        return;
+    }
+    printf("Frames: %llu, render CPU avg %.3f ms, max %.3f ms\n",
+           static_cast<unsigned long long>(status.framesRendered),
+           status.renderAvgMs, status.renderMaxMs);
+    if (!config_.uncapped) {
+        const SchedulerStats& stats = status.scheduler;
+        printf("Output clock: %.2f/%.2f fps, jitter avg %.0f us max %.0f us, missed %llu, message wakes %llu\n",
+               stats.actualFps, stats.targetFps, stats.avgJitterUs, stats.maxJitterUs,
+               static_cast<unsigned long long>(stats.missedDeadlines),
+               static_cast<unsigned long long>(stats.messageFrames));
+    }
+    for (const auto& timing : status.passTimings) {
+        printf("  %-8s GPU avg %.3f ms max %.3f ms, CPU avg %.3f ms max %.3f ms\n",
+               timing.name.c_str(), timing.gpuAvgMs, timing.gpuMaxMs, timing.cpuAvgMs, timing.cpuMaxMs);
     }
+    fflush(stdout);
 }
 
 void ReceiverApp::shutdown() {
     running_ = false;
 
+    // Stop message delivery before the pipeline it feeds
     if (subscriber_) {
         subscriber_->shutdown();
         subscriber_.reset();
     }
 
-    if (textureSenderSmall_) {
-        textureSenderSmall_->shutdown();
-        textureSenderSmall_.reset();
+    // run() has already joined the render thread by now. If it never started, the
+    // pipeline is freed here instead, so the render context must be current.
+    if (renderThread_) {
+        if (headlessContext_) {
+            headlessContext_->makeCurrent();
+        } else if (window_) {
+            glfwMakeContextCurrent(renderWindow_ ? renderWindow_ : window_);
+        }
+        renderThread_->stop();
+        renderThread_.reset();
     }
 
-    if (textureSenderBig_) {
-        textureSenderBig_->shutdown();
-        textureSenderBig_.reset();
+    if (feedbackPublisher_) {
+        feedbackPublisher_->shutdown();
+        feedbackPublisher_.reset();
     }
 
-    if (textRenderer_) {
-        textRenderer_->shutdown();
-        textRenderer_.reset();
-    }
+    healthMonitor_.reset();
 
-    if (blankTexture_) {
-        glDeleteTextures(1, &blankTexture_);
-        blankTexture_ = 0;
+    timingExport_.close();
+
+    // Shutdown ImGui
+    if (imguiInitialized_) {
+        glfwMakeContextCurrent(window_);
+        dashboardProfiler_.shutdown();
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
+        imguiInitialized_ = false;
     }
 
-    healthMonitor_.reset();
+    if (headlessContext_) {
+        headlessContext_->shutdown();
+        headlessContext_.reset();
+    }
 
-    // Shutdown ImGui
-    ImGui_ImplOpenGL3_Shutdown();
-    ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
+    if (renderWindow_) {
+        glfwDestroyWindow(renderWindow_);
+        renderWindow_ = nullptr;
+    }
 
     if (window_) {
         glfwDestroyWindow(window_);
@@ -206,49 +324,16 @@ void ReceiverApp::shutdown() {
 }
 
 void ReceiverApp::onMessageReceived(const TextMessage& message, int feedId) {
-    std::cout << "RECEIVER_DEBUG: Message received, type=" << static_cast<int>(message.type)
-              << ", feedId=" << feedId << std::endl;
-
-    switch (message.type) {
-        case MessageType::TEXT_UPDATE:
-            {
-                // Check if size changed - if so, flag that we need to clear the old output
-                TextSize previousSize = currentSize_;
-                currentText_ = message.getText();
-                currentSize_ = message.size;
-
-                // If size changed, mark that we need to clear the old output
-                if (previousSize != currentSize_) {
-                    needsClearOldOutput_ = true;
-                    outputToClear_ = previousSize;
-                    std::cout << "RECEIVER_DEBUG: Size changed from " << (previousSize == TextSize::SMALL ? "SMALL" : "BIG")
-                              << " to " << (currentSize_ == TextSize::SMALL ? "SMALL" : "BIG") << std::endl;
-                }
-
-                // Update with the new text and size
-                textRenderer_->updateText(currentText_, currentSize_);
-                std::cout << "RECEIVER_DEBUG: TEXT_UPDATE - text='" << currentText_ << "'" << std::endl;
-            }
-            break;
-
-        case MessageType::CLEAR_TEXT:
-            std::cout << "RECEIVER_DEBUG: CLEAR_TEXT received - starting fade out" << std::endl;
-            if (!currentText_.empty()) {
-                // Start fade out animation
-                fadingText_ = currentText_;
-                isFading_ = true;
-                fadeAlpha_ = 1.0f;
-                fadeStartTime_ = std::chrono::steady_clock::now();
-                // Mark that we need to clear the inactive output after fade completes
-                needsClearInactiveAfterFade_ = true;
-            }
-            textRenderer_->clearText();
-            currentText_.clear();
-            break;
-
-        case MessageType::HEARTBEAT:
-            // Heartbeats are handled automatically in the subscriber
-            break;
+    // Heartbeats are handled in the subscriber - don't wake the render thread for them
+    if (message.type == MessageType::HEARTBEAT) {
+        return;
+    }
+    if (renderThread_ && message.type == MessageType::CLOCK_PONG) {
+        renderThread_->onClockPong(message);
+        return;
+    }
+    if (renderThread_) {
+        renderThread_->post(message, feedId);
     }
 }
 
@@ -283,88 +368,120 @@ void ReceiverApp::updateHealthMonitoring() {
         }
     }
 
-    // Text renderer health
-    if (textRenderer_) {
-        healthMonitor_->updateMetric("Text Renderer", 1.0, HealthStatus::HEALTHY, "Operational");
+    // Everything below comes from the render thread's latest snapshot
+    const RenderStatus& status = renderThread_->getStatus();
+
+    // Output clock
+    if (!config_.uncapped) {
+        const SchedulerStats& stats = status.scheduler;
+        char details[160];
+        snprintf(details, sizeof(details), "%.2f/%.2f fps, jitter avg %.0f us max %.0f us, missed %llu",
+                 stats.actualFps, stats.targetFps, stats.avgJitterUs, stats.maxJitterUs,
+                 static_cast<unsigned long long>(stats.missedDeadlines));
+        // Lateness beyond a quarter frame means the output clock is visibly uneven
+        double quarterFrameUs = stats.targetFps > 0.0 ? 250000.0 / stats.targetFps : 0.0;
+        healthMonitor_->updateMetric("Output Clock", stats.actualFps,
+                                   stats.maxJitterUs > quarterFrameUs ? HealthStatus::WARNING : HealthStatus::HEALTHY,
+                                   details);
     }
 
-    // Texture sender health
-    if (textureSenderSmall_) {
-        bool senderHealthy = textureSenderSmall_->isInitialized();
-        std::string senderName = "Small Text Output (" + textureSenderSmall_->getPlatformInfo() + ")";
-        healthMonitor_->updateMetric(senderName, senderHealthy ? 1.0 : 0.0,
-                                   senderHealthy ? HealthStatus::HEALTHY : HealthStatus::CRITICAL);
+    // Text renderer health
+    char renderDetails[96];
+    snprintf(renderDetails, sizeof(renderDetails), "Render thread: %.2f ms avg, %.2f ms max",
+             status.renderAvgMs, status.renderMaxMs);
+    healthMonitor_->updateMetric("Text Renderer", 1.0, HealthStatus::HEALTHY, renderDetails);
+
+    // Safe-area fit of the current text - clipped text is visibly cut off on air
+    char fitDetails[96];
+    snprintf(fitDetails, sizeof(fitDetails), "%zu lines at %.0f%%%s, layout %.1f us",
+             status.fitLines, status.fitScale * 100.0f, (status.fitFlags & FIT_WRAPPED) ? ", wrapped" : "",
+             status.layoutUs);
+    healthMonitor_->updateMetric("Text Fit", status.fitScale,
+                               (status.fitFlags & FIT_CLIPPED) ? HealthStatus::WARNING : HealthStatus::HEALTHY,
+                               fitDetails);
+
+    // Self-healing against the sender's periodic state refresh
+    char stateDetails[128];
+    snprintf(stateDetails, sizeof(stateDetails), "revision %u, %llu refreshes matched, %llu repaired, %llu requested",
+             status.revision, static_cast<unsigned long long>(status.refreshesMatched),
+             static_cast<unsigned long long>(status.stateRepairs), static_cast<unsigned long long>(status.stateRequests));
+    healthMonitor_->updateMetric("Sender State", static_cast<double>(status.revision),
+                               status.inStep ? HealthStatus::HEALTHY : HealthStatus::WARNING, stateDetails);
+
+    // Clock sync behind presentation-timed flips
+    char clockDetails[128];
+    snprintf(clockDetails, sizeof(clockDetails), "offset %+.3f ms within %.2f ms, %zu samples, %llu timed flips",
+             status.clockOffsetUs / 1000.0, status.clockRttUs / 2000.0, status.clockSamples,
+             static_cast<unsigned long long>(status.timedFlips));
+    healthMonitor_->updateMetric("Clock Sync", status.clockRttUs / 2000.0,
+                               status.clockSynced ? HealthStatus::HEALTHY : HealthStatus::WARNING,
+                               status.clockSynced ? clockDetails : "Not synced - updates go up on arrival");
+
+    // Texture sender health and CPU readback outputs (platforms without native texture sharing)
+    const OutputStatus* outputs[] = {&status.small, &status.big};
+    const char* outputLabels[] = {"Small", "Big"};
+    for (int i = 0; i < 2; ++i) {
+        const OutputStatus& output = *outputs[i];
+        if (output.platformInfo.empty()) {
+            continue;  // No snapshot yet
+        }
+        std::string senderName = std::string(outputLabels[i]) + " Text Output (" + output.platformInfo + ")";
+        healthMonitor_->updateMetric(senderName, output.initialized ? 1.0 : 0.0,
+                                   output.initialized ? HealthStatus::HEALTHY : HealthStatus::CRITICAL);
+
+        if (output.hasReadback) {
+            char details[128];
+            snprintf(details, sizeof(details), "%.1f MB/s, latency %.1f frames, skipped %llu",
+                     output.readback.throughputMBps, output.readback.avgLatencyFrames,
+                     static_cast<unsigned long long>(output.readback.framesSkipped));
+            healthMonitor_->updateMetric(std::string(outputLabels[i]) + " Readback",
+                                       output.readback.throughputMBps, HealthStatus::HEALTHY, details);
+        }
     }
 
-    if (textureSenderBig_) {
-        bool senderHealthy = textureSenderBig_->isInitialized();
-        std::string senderName = "Big Text Output (" + textureSenderBig_->getPlatformInfo() + ")";
-        healthMonitor_->updateMetric(senderName, senderHealthy ? 1.0 : 0.0,
-                                   senderHealthy ? HealthStatus::HEALTHY : HealthStatus::CRITICAL);
+    // Per-output frame pacing from the swap chain
+    for (const auto& consumer : status.swapConsumers) {
+        std::string details = "Dropped: " + std::to_string(consumer.stats.droppedFrames) +
+                              ", Duplicated: " + std::to_string(consumer.stats.duplicatedFrames) +
+                              ", Skipped: " + std::to_string(consumer.stats.skippedFrames);
+        healthMonitor_->updateMetric(consumer.name + " Frames",
+                                   static_cast<double>(consumer.stats.framesConsumed),
+                                   consumer.stats.skippedFrames > 0 ? HealthStatus::WARNING : HealthStatus::HEALTHY,
+                                   details);
     }
-}
 
-void ReceiverApp::updateFade() {
-    if (isFading_) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration<float>(now - fadeStartTime_).count();
-
-        if (elapsed >= FADE_DURATION_SECONDS) {
-            // Fade complete
-            isFading_ = false;
-            fadeAlpha_ = 0.0f;
-            fadingText_.clear();
-
-            // If we need to clear the inactive output, mark it
-            if (needsClearInactiveAfterFade_) {
-                TextSize inactiveSize = (currentSize_ == TextSize::SMALL) ? TextSize::BIG : TextSize::SMALL;
-                needsClearOldOutput_ = true;
-                outputToClear_ = inactiveSize;
-                needsClearInactiveAfterFade_ = false;
-            }
-        } else {
-            // Calculate fade alpha (1.0 to 0.0)
-            fadeAlpha_ = 1.0f - (elapsed / FADE_DURATION_SECONDS);
-        }
+    // Per-pass GPU/CPU time, render thread and dashboard
+    double frameBudgetMs = config_.outputRate.fps() > 0.0 ? 1000.0 / config_.outputRate.fps() : 0.0;
+    for (const auto& timing : status.passTimings) {
+        updatePassMetric(timing, frameBudgetMs);
+    }
+    std::vector<PassTiming> dashboardTimings;
+    dashboardProfiler_.getTimings(dashboardTimings);
+    for (const auto& timing : dashboardTimings) {
+        updatePassMetric(timing, 1000.0 / DASHBOARD_FPS);
     }
 }
 
-void ReceiverApp::render() {
-    std::cout << "ReceiverApp::render - currentSize=" << (currentSize_ == TextSize::SMALL ? "SMALL" : "BIG")
-              << ", currentText='" << currentText_ << "'" << std::endl;
-
-    // Render text with current size (TextRenderer handles fade internally)
-    textRenderer_->render();
-
-    // Get the rendered texture
-    GLuint textureID = textRenderer_->getRenderedTexture();
-    std::cout << "ReceiverApp::render - textureID=" << textureID << std::endl;
-
-    // Always send to both outputs - active gets rendered text, inactive gets blank
-    glFinish();
-
-    if (currentSize_ == TextSize::SMALL) {
-        // Small mode: send rendered text to small output, blank to big output
-        std::cout << "ReceiverApp::render - sending rendered text to SMALL output, blank to BIG output" << std::endl;
-        if (textureID > 0) {
-            textureSenderSmall_->sendTexture(textureID, SYPHON_WIDTH, SYPHON_HEIGHT);
-        }
-        textureSenderBig_->sendTexture(blankTexture_, SYPHON_WIDTH, SYPHON_HEIGHT);
-    } else {
-        // Big mode: send rendered text to big output, blank to small output
-        std::cout << "ReceiverApp::render - sending rendered text to BIG output, blank to SMALL output" << std::endl;
-        if (textureID > 0) {
-            textureSenderBig_->sendTexture(textureID, SYPHON_WIDTH, SYPHON_HEIGHT);
-        }
-        textureSenderSmall_->sendTexture(blankTexture_, SYPHON_WIDTH, SYPHON_HEIGHT);
-    }
+void ReceiverApp::updatePassMetric(const PassTiming& timing, double frameBudgetMs) {
+    char details[128];
+    snprintf(details, sizeof(details), "GPU avg %.2f ms max %.2f ms, CPU avg %.2f ms max %.2f ms",
+             timing.gpuAvgMs, timing.gpuMaxMs, timing.cpuAvgMs, timing.cpuMaxMs);
+    // A single pass eating half the frame leaves no headroom for the rest
+    bool overBudget = frameBudgetMs > 0.0 && std::max(timing.gpuMaxMs, timing.cpuMaxMs) > frameBudgetMs * 0.5;
+    healthMonitor_->updateMetric("Pass " + timing.name, timing.gpuAvgMs,
+                               overBudget ? HealthStatus::WARNING : HealthStatus::HEALTHY, details);
+}
 
+void ReceiverApp::renderDashboard() {
     // Render ImGui interface
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
+    dashboardProfiler_.beginFrame();
+    dashboardProfiler_.beginPass(0);
+
     // Start ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
@@ -377,80 +494,30 @@ void ReceiverApp::render() {
                  ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove |
                  ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoBringToFrontOnFocus);
 
-    // Display current text (large and centered like sender)
-    // Determine what text to display and with what alpha
-    std::string textToDisplay;
-    float alpha = 1.0f;
-    TextSize sizeToUse = currentSize_;
-
-    if (!currentText_.empty()) {
-        // Display current text at full opacity
-        textToDisplay = currentText_;
-        alpha = 1.0f;
-    } else if (isFading_ && !fadingText_.empty()) {
-        // Display fading text with fade alpha
-        textToDisplay = fadingText_;
-        alpha = fadeAlpha_;
-    }
-    // If no current text and not fading, display nothing (blank screen)
-
-    std::cout << "ReceiverApp::render - IMGUI DISPLAY - textToDisplay='" << textToDisplay
-              << "', alpha=" << alpha << ", currentText_='" << currentText_ << "'" << std::endl;
-
-    if (!textToDisplay.empty()) {
-        ImGuiIO& io = ImGui::GetIO();
-
-        // Get the appropriate ABF font (no scaling needed - using native font sizes)
-        ImFont* abfFont = (sizeToUse == TextSize::BIG) ? io.Fonts->Fonts[2] : io.Fonts->Fonts[1];
-
-        ImGui::PushFont(abfFont);
-        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-
-        // Apply alpha for fade effect
-        if (alpha < 1.0f) {
-            ImVec4 textColor = ImGui::GetStyleColorVec4(ImGuiCol_Text);
-            textColor.w = alpha;
-            ImGui::PushStyleColor(ImGuiCol_Text, textColor);
-        }
-
-        // Split text into lines for per-line centering like the sender
-        std::vector<std::string> lines;
-        std::stringstream ss(textToDisplay);
-        std::string line;
-        while (std::getline(ss, line)) {
-            lines.push_back(line);
-        }
-
-        // Calculate total text height
-        float lineHeight = ImGui::GetTextLineHeight();
-        float totalTextHeight = lines.size() * lineHeight;
-
-        // Get available content region (ImGui window content area)
-        ImVec2 contentRegion = ImGui::GetContentRegionAvail();
-        float startY = (contentRegion.y - totalTextHeight) * 0.5f;
-
-        // Render each line centered horizontally
-        for (size_t i = 0; i < lines.size(); ++i) {
-            float lineWidth = ImGui::CalcTextSize(lines[i].c_str()).x;
-            float centerX = (contentRegion.x - lineWidth) * 0.5f;
+    const RenderStatus& status = renderThread_->getStatus();
 
-            ImGui::SetCursorPosX(centerX);
-            ImGui::SetCursorPosY(startY + i * lineHeight);
-            ImGui::TextUnformatted(lines[i].c_str());
+    // Preview of the actual output, fitted above the status area
+    if (status.previewTexture) {
+        ImVec2 area(ImGui::GetContentRegionAvail().x, WINDOW_HEIGHT - 140.0f - ImGui::GetCursorPosY());
+        float aspect = static_cast<float>(status.previewWidth) / status.previewHeight;
+        ImVec2 size(area.x, area.x / aspect);
+        if (size.y > area.y) {
+            size = ImVec2(area.y * aspect, area.y);
         }
+        ImGui::SetCursorPosX(ImGui::GetCursorPosX() + (area.x - size.x) * 0.5f);
 
-        // Pop alpha style if applied
-        if (alpha < 1.0f) {
-            ImGui::PopStyleColor();
-        }
+        // Dark backdrop so the transparent output reads like it will over black
+        ImVec2 pos = ImGui::GetCursorScreenPos();
+        ImGui::GetWindowDrawList()->AddRectFilled(pos, ImVec2(pos.x + size.x, pos.y + size.y),
+                                                  ImGui::ColorConvertFloat4ToU32(ImVec4(0.0f, 0.0f, 0.0f, 1.0f)));
 
-        ImGui::PopStyleVar();
-        ImGui::PopFont();
+        // GL textures are bottom-up, so flip V
+        ImGui::Image(reinterpret_cast<ImTextureID>(static_cast<intptr_t>(status.previewTexture)),
+                     size, ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f));
     }
-    // No else clause - blank screen when no text to display
 
     // Show network status with traffic lights at the bottom
-    ImGui::SetCursorPosY(WINDOW_HEIGHT - 100);
+    ImGui::SetCursorPosY(WINDOW_HEIGHT - 120);
     ImGui::Separator();
 
     // Network Traffic Lights and Statistics
@@ -506,7 +573,7 @@ void ReceiverApp::render() {
         // Active feed and text size info
         ImGui::Text("Active Feed: %d | Text Size: %s",
                    subscriber_->getActiveFeed() + 1,
-                   (currentSize_ == TextSize::BIG) ? "Large" : "Small");
+                   (status.currentSize == TextSize::BIG) ? "Large" : "Small");
 
         // Overall statistics (compact)
         uint64_t totalReceived = 0, totalBytes = 0;
@@ -518,6 +585,59 @@ void ReceiverApp::render() {
         ImGui::SameLine();
         ImGui::Text("| Total: %lu msg, %.1f KB", totalReceived, totalBytes / 1024.0);
 
+        if (!config_.uncapped) {
+            const SchedulerStats& clock = status.scheduler;
+            ImGui::Text("Output: %.2f/%.2f fps | Jitter avg %.0f us, max %.0f us | Missed %llu",
+                       clock.actualFps, clock.targetFps, clock.avgJitterUs, clock.maxJitterUs,
+                       static_cast<unsigned long long>(clock.missedDeadlines));
+        }
+
+        if (status.fitLines > 0) {
+            ImVec4 fitColor = (status.fitFlags & FIT_CLIPPED) ? ImVec4(1.0f, 0.3f, 0.3f, 1.0f) :
+                              (status.fitFlags & FIT_SHRUNK) ? ImVec4(1.0f, 1.0f, 0.0f, 1.0f) :
+                                                               ImVec4(0.7f, 0.7f, 0.7f, 1.0f);
+            ImGui::TextColored(fitColor, "Fit: %zu lines at %.0f%%%s%s | Layout %.1f us",
+                               status.fitLines, status.fitScale * 100.0f,
+                               (status.fitFlags & FIT_WRAPPED) ? ", wrapped" : "",
+                               (status.fitFlags & FIT_CLIPPED) ? ", CLIPPED" : "", status.layoutUs);
+        }
+
+        ImGui::TextDisabled("State: revision %u | %llu refreshes matched, %llu repaired, %llu requested",
+                            status.revision, static_cast<unsigned long long>(status.refreshesMatched),
+                            static_cast<unsigned long long>(status.stateRepairs),
+                            static_cast<unsigned long long>(status.stateRequests));
+        if (status.inStep) {
+            ImGui::TextDisabled("Joined: correct frame %.1f ms after launch%s", status.correctFrameMs,
+                                status.restoredState ? " (started from the state file)" : "");
+        } else {
+            ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Joining: waiting for the sender's state%s",
+                               status.restoredState ? " - showing the restored text" : "");
+        }
+        if (status.stagedCues > 0 || status.cuesTaken > 0 || status.cueMisses > 0) {
+            ImGui::TextDisabled("Cues: %zu staged | %llu taken (last GO %.1f us), %llu not staged",
+                                status.stagedCues, static_cast<unsigned long long>(status.cuesTaken),
+                                status.cueGoUs, static_cast<unsigned long long>(status.cueMisses));
+        }
+        if (status.clockSynced) {
+            ImGui::TextDisabled("Clock: sender %+.3f ms (within %.2f ms, %zu samples) | %llu timed flips, %.2f ms avg / %.2f ms max after target",
+                                status.clockOffsetUs / 1000.0, status.clockRttUs / 2000.0, status.clockSamples,
+                                static_cast<unsigned long long>(status.timedFlips),
+                                status.flipLateAvgUs / 1000.0, status.flipLateMaxUs / 1000.0);
+        } else {
+            ImGui::TextDisabled("Clock: not synced to the sender - updates go up on arrival");
+        }
+
+        // Per-pass GPU/CPU ms, rolling over the last few seconds
+        std::vector<PassTiming> passTimings = status.passTimings;
+        std::vector<PassTiming> dashboardTimings;
+        dashboardProfiler_.getTimings(dashboardTimings);
+        passTimings.insert(passTimings.end(), dashboardTimings.begin(), dashboardTimings.end());
+        ImGui::Text("Passes (GPU/CPU ms):");
+        for (const auto& timing : passTimings) {
+            ImGui::SameLine();
+            ImGui::Text("%s %.2f/%.2f", timing.name.c_str(), timing.gpuAvgMs, timing.cpuAvgMs);
+        }
+
     } else {
         // No network connection
         ImDrawList* draw_list = ImGui::GetWindowDrawList();
@@ -533,7 +653,7 @@ void ReceiverApp::render() {
         ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "Network: NOT INITIALIZED");
 
         ImGui::SameLine();
-        ImGui::TextDisabled("| Text Size: %s", (currentSize_ == TextSize::BIG) ? "Large" : "Small");
+        ImGui::TextDisabled("| Text Size: %s", (status.currentSize == TextSize::BIG) ? "Large" : "Small");
     }
 
     ImGui::End();
@@ -541,6 +661,7 @@ void ReceiverApp::render() {
     // Render ImGui
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    dashboardProfiler_.endPass(0);
 
     glfwSwapBuffers(window_);
 }
@@ -548,7 +669,7 @@ void ReceiverApp::render() {
 // Static callbacks
 void ReceiverApp::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
     ReceiverApp* app = static_cast<ReceiverApp*>(glfwGetWindowUserPointer(window));
-    if (app && app->textRenderer_) {
+    if (app) {
         // Note: Keep Syphon outputs and text renderer at 4K regardless of window size
         // Only the display window is Full HD
     }
@@ -6,57 +6,66 @@
 #include "common/AeronConnection.h"
 #include "common/HealthMonitor.h"
 #include "common/TextMessage.h"
-#include "TextRenderer.h"
-#include "TextureSender.h"
+#include "GpuProfiler.h"
+#include "HeadlessContext.h"
+#include "ReceiverConfig.h"
+#include "RenderThread.h"
 
 namespace LiveText {
 
 class ReceiverApp {
 public:
-    ReceiverApp();
+    explicit ReceiverApp(const ReceiverConfig& config = ReceiverConfig());
     ~ReceiverApp();
 
     bool initialize();
     void run();
     void shutdown();
 
+    // Safe to call from a signal handler
+    void requestStop() { running_ = false; }
+
 private:
-    // GLFW and OpenGL
+    ReceiverConfig config_;
+
+    // GLFW and OpenGL - the UI window's context only draws the dashboard;
+    // the output pipeline renders on its own context shared with it
     GLFWwindow* window_;
+    GLFWwindow* renderWindow_;  // Hidden, owns the render thread's context (windowed mode)
+    std::unique_ptr<HeadlessContext> headlessContext_;
+    bool imguiInitialized_;
 
     // Aeron communication
     std::unique_ptr<AeronSubscriber> subscriber_;
+    std::unique_ptr<AeronPublisher> feedbackPublisher_;  // Fit reports back to the sender
 
-    // Rendering
-    std::unique_ptr<TextRenderer> textRenderer_;
-    std::unique_ptr<TextureSender> textureSenderSmall_;  // Syphon output for small text
-    std::unique_ptr<TextureSender> textureSenderBig_;    // Syphon output for big text
-    GLuint blankTexture_;  // Blank texture for clearing inactive output
+    // Output pipeline on its own thread
+    std::unique_ptr<RenderThread> renderThread_;
 
     // Health monitoring
     std::unique_ptr<HealthMonitor> healthMonitor_;
+    GpuProfiler dashboardProfiler_;  // ImGui pass on the UI context
+    TimingExport timingExport_;
+    std::vector<GpuTimingSample> timingSamples_;
 
     // Application state
     std::atomic<bool> running_;
-    std::string currentText_;
-    TextSize currentSize_;
-    bool needsClearOldOutput_;
-    TextSize outputToClear_;
-    bool needsClearInactiveAfterFade_;
-
-    // Fade out animation state
-    bool isFading_;
-    float fadeAlpha_;
-    std::chrono::steady_clock::time_point fadeStartTime_;
-    std::string fadingText_;
 
     // Callbacks
-    void onMessageReceived(const TextMessage& message, int feedId);
+    void onMessageReceived(const TextMessage& message, int feedId);  // Network thread
+
+    // Setup
+    bool initializeWindow();
+    bool initializeHeadless();
+    void initializeImGui();
+    void startRenderThread();
 
-    // Update methods
+    // UI thread
     void updateHealthMonitoring();
-    void updateFade();
-    void render();
+    void updatePassMetric(const PassTiming& timing, double frameBudgetMs);
+    void exportTimings();
+    void renderDashboard();
+    void printStatus() const;
 
     // Configuration
     static constexpr int WINDOW_WIDTH = 1920;   // Full HD for display window
@@ -64,16 +73,19 @@ private:
     static constexpr int SYPHON_WIDTH = 3840;   // 4K for Syphon outputs
     static constexpr int SYPHON_HEIGHT = 2160;  // 4K for Syphon outputs
     static constexpr const char* TEXTURE_SENDER_NAME = "LiveText";
-    static constexpr float FADE_DURATION_SECONDS = 2.0f;
+    static constexpr double DASHBOARD_FPS = 30.0;  // UI redraw rate - independent of the output clock
+    static constexpr int HEADLESS_STATUS_INTERVAL_SECONDS = 10;
 
     // Aeron configuration - using localhost unicast instead of multicast
     static constexpr const char* PRIMARY_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9999";
     static constexpr const char* SECONDARY_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9998";
     static constexpr int STREAM_ID = 1001;
+    static constexpr const char* FEEDBACK_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9997";
+    static constexpr int FEEDBACK_STREAM_ID = 1002;
 
     // Window callbacks
     static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
     static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
 };
 
-} // namespace LiveText
\ No newline at end of file
+} // namespace LiveText
@@ -0,0 +1,23 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "FrameScheduler.h"
+
+namespace LiveText {
+
+struct ReceiverConfig {
+    bool headless = false;      // Offscreen context, no window or ImGui - text pipeline and outputs only
+    uint64_t maxFrames = 0;     // Exit after this many frames and print render timing (0 = run forever)
+    bool uncapped = false;      // Render as fast as possible instead of pacing to the output rate
+    FrameRate outputRate;       // Output clock - 50, 59.94 (60000/1001) or 60
+    WakePolicy wakePolicy = WakePolicy::WAKE_ON_MESSAGE;
+    double previewFps = 15.0;   // Dashboard preview refresh rate (0 = no preview)
+    int previewWidth = 1280;    // Dashboard preview resolution (height follows the output aspect)
+    float safeArea = 0.9f;      // Text is wrapped and shrunk to fit this centered fraction of the output
+    std::string timingExportPath;  // CSV of per-pass CPU/GPU timestamps (empty = no export)
+    std::string stateFilePath = "livetext-receiver.state";  // Last shown state, restored at startup (empty = none)
+    std::chrono::steady_clock::time_point launchTime = std::chrono::steady_clock::now();  // For the first-frame and correct-frame reports
+};
+
+} // namespace LiveText
@@ -0,0 +1,48 @@
+#include "ReceiverStateStore.h"
+#include <atomic>
+#include <cstring>
+#include <iostream>
+
+namespace LiveText {
+
+bool ReceiverStateStore::open(const std::string& path) {
+    if (!file_.openReadWrite(path, sizeof(Record))) {
+        std::cerr << "Failed to open receiver state file " << path << " - state will not survive a restart" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ReceiverStateStore::load(TextMessage& state) const {
+    if (!isOpen()) {
+        return false;
+    }
+
+    const Record* r = record();
+    if (r->magic != MAGIC || r->version != VERSION || (r->sequence & 1) != 0 ||
+        r->length > sizeof(r->message) || !state.deserialize(r->message, r->length)) {
+        return false;
+    }
+    return state.type == MessageType::TEXT_UPDATE || state.type == MessageType::CLEAR_TEXT;
+}
+
+void ReceiverStateStore::save(const TextMessage& state) {
+    if (!isOpen()) {
+        return;
+    }
+
+    // Odd even if a crash left the last save half done
+    Record* r = record();
+    uint32_t sequence = (r->sequence + 1) | 1;
+    r->sequence = sequence;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    r->magic = MAGIC;
+    r->version = VERSION;
+    r->length = static_cast<uint32_t>(state.serialize(r->message, sizeof(r->message)));
+
+    std::atomic_thread_fence(std::memory_order_release);
+    r->sequence = sequence + 1;
+}
+
+} // namespace LiveText
@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include "common/MappedFile.h"
+#include "common/TextMessage.h"
+
+namespace LiveText {
+
+// The last state the receiver put on screen - a TEXT_UPDATE or CLEAR_TEXT
+// with its revision, hash and timestamp - kept in a small memory-mapped file.
+// A restarted receiver loads it before the network is up, so the outputs
+// show the current cue from the first frame rather than nothing.
+//
+// save() is a memcpy into the mapping (no system call), so the render thread
+// calls it on every state change. A sequence number that is odd while a
+// record is being written lets load() reject one torn by a crash.
+class ReceiverStateStore {
+public:
+    bool open(const std::string& path);
+    void close() { file_.close(); }
+    bool isOpen() const { return file_.isOpen(); }
+    const std::string& path() const { return file_.path(); }
+
+    // False if there is no complete record
+    bool load(TextMessage& state) const;
+    void save(const TextMessage& state);
+
+private:
+    static constexpr uint32_t MAGIC = 0x5352544C;   // "LTRS"
+    static constexpr uint32_t VERSION = 3;   // Bump when the TextMessage header changes
+
+    struct Record {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t sequence;      // Odd while a save is in progress
+        uint32_t length;        // Serialized message bytes
+        uint8_t message[TextMessage::getMaxSerializedSize()];
+    };
+
+    MappedFile file_;
+
+    Record* record() { return reinterpret_cast<Record*>(file_.mutableData()); }
+    const Record* record() const { return reinterpret_cast<const Record*>(file_.data()); }
+};
+
+} // namespace LiveText
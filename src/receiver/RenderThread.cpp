@@ -0,0 +1,629 @@
+#include "RenderThread.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+namespace LiveText {
+
+RenderThread::RenderThread(const ReceiverConfig& config)
+    : config_(config)
+    , outputWidth_(0)
+    , outputHeight_(0)
+    , blankTexture_(0)
+    , swapConsumerSmall_(-1)
+    , swapConsumerBig_(-1)
+    , swapConsumerPreview_(-1)
+    , currentSize_(TextSize::SMALL)
+    , appliedRevision_(0)
+    , appliedTimestamp_(0)
+    , refreshesMatched_(0)
+    , stateRepairs_(0)
+    , stateRequests_(0)
+    , restoredState_(false)
+    , inStep_(false)
+    , inStepReason_(nullptr)
+    , correctFrameMs_(0.0)
+    , cuesTaken_(0)
+    , cueMisses_(0)
+    , cueGoUs_(0.0)
+    , lastPresentedRevision_(0)
+    , timedFlips_(0)
+    , flipLateTotalUs_(0)
+    , flipLateMaxUs_(0)
+    , running_(false)
+    , finished_(false)
+    , framesRendered_(0)
+    , renderTimeTotalMs_(0.0)
+    , renderTimeMaxMs_(0.0)
+{
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::initialize(int outputWidth, int outputHeight, bool enablePreview) {
+    outputWidth_ = outputWidth;
+    outputHeight_ = outputHeight;
+
+    // Initialize text renderer at 4K resolution for Syphon outputs
+    textRenderer_ = std::make_unique<TextRenderer>();
+    if (!textRenderer_->initialize(outputWidth_, outputHeight_)) {
+        std::cerr << "Failed to initialize text renderer" << std::endl;
+        return false;
+    }
+    textRenderer_->setSafeArea(config_.safeArea);
+
+    // Initialize texture senders (Spout on Windows, Syphon on macOS) at 4K resolution
+    // Small text output
+    textureSenderSmall_ = std::make_unique<TextureSender>();
+    if (!textureSenderSmall_->initialize("LiveText-Small", outputWidth_, outputHeight_)) {
+        std::cerr << "Failed to initialize small texture sender" << std::endl;
+        return false;
+    }
+    std::cout << "Small text output initialized (4K): " << textureSenderSmall_->getPlatformInfo() << std::endl;
+
+    // Big text output
+    textureSenderBig_ = std::make_unique<TextureSender>();
+    if (!textureSenderBig_->initialize("LiveText-Big", outputWidth_, outputHeight_)) {
+        std::cerr << "Failed to initialize big texture sender" << std::endl;
+        return false;
+    }
+    std::cout << "Big text output initialized (4K): " << textureSenderBig_->getPlatformInfo() << std::endl;
+
+    smallInfo_.initialized = textureSenderSmall_->isInitialized();
+    smallInfo_.platformInfo = textureSenderSmall_->getPlatformInfo();
+    smallInfo_.hasReadback = textureSenderSmall_->hasReadback();
+    bigInfo_.initialized = textureSenderBig_->isInitialized();
+    bigInfo_.platformInfo = textureSenderBig_->getPlatformInfo();
+    bigInfo_.hasReadback = textureSenderBig_->hasReadback();
+
+    // Each output consumes frames from the renderer's swap chain independently
+    swapConsumerSmall_ = textRenderer_->getSwapChain()->registerConsumer("LiveText-Small");
+    swapConsumerBig_ = textRenderer_->getSwapChain()->registerConsumer("LiveText-Big");
+
+    // Dashboard preview is a throttled downscale of the real output
+    if (enablePreview && config_.previewFps > 0.0) {
+        preview_ = std::make_unique<PreviewRenderer>();
+        if (preview_->initialize(outputWidth_, outputHeight_, config_.previewWidth)) {
+            preview_->setUpdateRate(config_.previewFps);
+            swapConsumerPreview_ = textRenderer_->getSwapChain()->registerConsumer("Preview");
+        } else {
+            std::cerr << "Failed to initialize output preview" << std::endl;
+            preview_->shutdown();
+            preview_.reset();
+        }
+    }
+
+    // Create a blank texture for clearing inactive outputs
+    glGenTextures(1, &blankTexture_);
+    glBindTexture(GL_TEXTURE_2D, blankTexture_);
+    std::vector<unsigned char> blankData(static_cast<size_t>(outputWidth_) * outputHeight_ * 4, 0);  // RGBA all zeros (transparent black)
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, outputWidth_, outputHeight_, 0, GL_RGBA, GL_UNSIGNED_BYTE, blankData.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    std::cout << "Blank texture created for clearing inactive outputs" << std::endl;
+
+    // Per-pass GPU timing - order matches the Pass enum
+    if (profiler_.initialize({"Text", "Send", "Blank", "Preview"})) {
+        profiler_.setExportEnabled(!config_.timingExportPath.empty());
+    }
+
+    // Output clock
+    scheduler_ = std::make_unique<FrameScheduler>(config_.outputRate, config_.wakePolicy);
+    std::cout << "Output rate: " << config_.outputRate.fps() << " fps ("
+              << (config_.wakePolicy == WakePolicy::WAKE_ON_MESSAGE ? "wake on message" : "deadline only")
+              << ")" << std::endl;
+
+    // Last shown state, on the outputs before the network is even up
+    if (!config_.stateFilePath.empty() && stateStore_.open(config_.stateFilePath)) {
+        TextMessage state;
+        if (stateStore_.load(state)) {
+            applyState(state);
+            restoredState_ = true;
+            std::cout << "Restored revision " << state.revision << " (" << state.textLength
+                      << " bytes of text) from " << stateStore_.path() << std::endl;
+        }
+    }
+
+    // Make sure every resource exists before another context or thread touches it
+    glFinish();
+    return true;
+}
+
+void RenderThread::start(ContextCallback makeCurrent, ContextCallback releaseCurrent) {
+    makeCurrent_ = std::move(makeCurrent);
+    releaseCurrent_ = std::move(releaseCurrent);
+    running_ = true;
+    thread_ = std::thread(&RenderThread::threadMain, this);
+}
+
+void RenderThread::stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+        if (scheduler_) {
+            scheduler_->notify();
+        }
+        thread_.join();
+    } else {
+        shutdownGL();
+    }
+}
+
+void RenderThread::post(const TextMessage& message, int feedId) {
+    mailbox_.post(message, feedId);
+    if (scheduler_) {
+        scheduler_->notify();
+    }
+}
+
+void RenderThread::threadMain() {
+    Logger::instance().setThreadName("render");
+    if (makeCurrent_) {
+        makeCurrent_();
+    }
+
+    auto runStart = std::chrono::steady_clock::now();
+    scheduler_->start();
+
+    while (running_) {
+        // Sleep until the next output deadline, or until a message arrives
+        if (!config_.uncapped) {
+            scheduler_->waitForNextFrame();
+        }
+        if (!running_) {
+            break;
+        }
+
+        // Everything due by the time this frame starts goes up in it
+        uint64_t frameTime = ClockSync::now();
+        processMailbox();
+        presentDue(frameTime);
+
+        auto now = std::chrono::steady_clock::now();
+        if (!inStep_) {
+            requestState(now);
+        }
+        pingClock(now);
+        renderFrame();
+        publishStatus();
+
+        if (inStepReason_) {
+            // Late-join report: the first frame that is known to show what the sender shows
+            glFinish();
+            correctFrameMs_ = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - config_.launchTime).count();
+            printf("Correct frame rendered %.1f ms after launch (%s, revision %u)\n",
+                   correctFrameMs_, inStepReason_, appliedRevision_);
+            inStepReason_ = nullptr;
+        }
+
+        if (framesRendered_ == 1) {
+            // Startup report: includes font atlas, GL setup and the first frame reaching the GPU
+            glFinish();
+            printf("First frame rendered %.1f ms after launch\n", std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - config_.launchTime).count());
+        }
+
+        if (config_.maxFrames > 0 && framesRendered_ >= config_.maxFrames) {
+            break;
+        }
+    }
+
+    if (config_.maxFrames > 0) {
+        // Include outstanding GPU work in the wall-clock figure
+        glFinish();
+        printBenchmark(std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count());
+    }
+
+    shutdownGL();
+    if (releaseCurrent_) {
+        releaseCurrent_();
+    }
+    finished_ = true;
+}
+
+void RenderThread::processMailbox() {
+    mailbox_.drain(pendingMessages_);
+    for (const auto& entry : pendingMessages_) {
+        handleMessage(entry.message, entry.feedId);
+    }
+}
+
+void RenderThread::handleMessage(const TextMessage& message, int feedId) {
+    LT_LOG_DEBUG("RECEIVER_DEBUG: Message received, type=%d, feedId=%d", static_cast<int>(message.type), feedId);
+
+    switch (message.type) {
+        case MessageType::TEXT_UPDATE:
+        case MessageType::CLEAR_TEXT:
+        case MessageType::CUE_GO:
+            scheduleUpdate(message);
+            break;
+
+        case MessageType::STATE_REFRESH:
+            handleStateRefresh(message);
+            break;
+
+        case MessageType::CUE_PRELOAD:
+            // Layout and glyphs now, while nothing is waiting on them
+            textRenderer_->stageCue(message.cueId, message.getText(), message.size);
+            break;
+
+        case MessageType::HEARTBEAT:
+        case MessageType::FIT_REPORT:
+        case MessageType::STATE_REQUEST:
+        case MessageType::CLOCK_PING:
+        case MessageType::CLOCK_PONG:
+        case MessageType::PRESENT_REPORT:
+            // Heartbeats are handled automatically in the subscriber and pongs by ReceiverApp before
+            // the mailbox; fit reports, requests, pings and present reports are outbound only
+            break;
+    }
+}
+
+void RenderThread::scheduleUpdate(const TextMessage& message) {
+    // Next frame if the sender gave no time or our clock is not synced to its yet
+    uint64_t presentAt = 0;
+    if (message.presentAt != 0 && clockSync_.isSynced()) {
+        presentAt = clockSync_.toLocal(message.presentAt);
+        uint64_t now = ClockSync::now();
+        if (presentAt > now + MAX_PRESENT_AHEAD_MS * 1000ull) {
+            LT_LOG_WARNING("Update %u is due %.0f ms from now - clock estimate looks wrong, showing it now",
+                           message.revision, (presentAt - now) / 1000.0);
+            presentAt = 0;
+        }
+    }
+    scheduled_.push_back({message, presentAt});
+}
+
+void RenderThread::presentDue(uint64_t frameTime) {
+    // In arrival order, so an update never overtakes an earlier one
+    while (!scheduled_.empty() && scheduled_.front().presentAt <= frameTime) {
+        ScheduledUpdate due = scheduled_.front();
+        scheduled_.pop_front();
+
+        if (due.message.type == MessageType::CUE_GO) {
+            applyCue(due.message);
+        } else {
+            applyState(due.message);
+            markInStep("update received");
+        }
+
+        // Once per revision - the copy from the other feed goes up in the same frame or later
+        if (due.presentAt == 0 || due.message.revision == lastPresentedRevision_) {
+            continue;
+        }
+        lastPresentedRevision_ = due.message.revision;
+
+        uint64_t lateUs = frameTime - due.presentAt;
+        timedFlips_++;
+        flipLateTotalUs_ += lateUs;
+        flipLateMaxUs_ = std::max(flipLateMaxUs_, lateUs);
+
+        // The sender compares receivers' reports to see how far apart the screens flipped
+        if (feedbackCallback_) {
+            feedbackCallback_(TextMessage::createPresentReport(clockSync_.getPeerId(), due.message.revision,
+                                                               due.message.presentAt, clockSync_.toSender(frameTime)));
+        }
+    }
+}
+
+void RenderThread::pingClock(std::chrono::steady_clock::time_point now) {
+    int interval = clockSync_.getSampleCount() < ClockSync::WINDOW ? CLOCK_PING_FAST_MS : CLOCK_PING_INTERVAL_MS;
+    if (feedbackCallback_ && now - lastClockPing_ >= std::chrono::milliseconds(interval)) {
+        feedbackCallback_(clockSync_.makePing());
+        lastClockPing_ = now;
+    }
+}
+
+void RenderThread::applyState(const TextMessage& message) {
+    appliedRevision_ = message.revision;
+    appliedTimestamp_ = message.timestamp;
+
+    if (message.type == MessageType::CLEAR_TEXT) {
+        if ((message.stateFlags & STATE_FADING) && message.textLength > 0) {
+            // Joined mid-fade - put the text up and pick the fade up where the sender's is
+            currentSize_ = message.size;
+            textRenderer_->updateText(message.getText(), currentSize_);
+            textRenderer_->clearText(message.fadeElapsedMs / 1000.0f);
+        } else {
+            // TextRenderer runs the fade-out itself
+            LT_LOG_DEBUG("RECEIVER_DEBUG: CLEAR_TEXT received - starting fade out");
+            textRenderer_->clearText();
+        }
+        currentText_.clear();
+
+        // A restart mid-fade comes back blank
+        TextMessage cleared = message;
+        cleared.stateFlags = 0;
+        cleared.setText("");
+        stateStore_.save(cleared);
+        return;
+    }
+
+    stateStore_.save(message);
+
+    TextSize previousSize = currentSize_;
+    currentText_ = message.getText();
+    currentSize_ = message.size;
+
+    if (previousSize != currentSize_) {
+        LT_LOG_DEBUG("RECEIVER_DEBUG: Size changed from %s to %s",
+                     previousSize == TextSize::SMALL ? "SMALL" : "BIG",
+                     currentSize_ == TextSize::SMALL ? "SMALL" : "BIG");
+    }
+
+    // Update with the new text and size
+    textRenderer_->updateText(currentText_, currentSize_);
+    LT_LOG_DEBUG("RECEIVER_DEBUG: TEXT_UPDATE - text='%s'", currentText_);
+
+    reportFit(message);
+}
+
+void RenderThread::applyCue(const TextMessage& message) {
+    // The same GO from the other feed
+    if (message.revision == appliedRevision_ && message.timestamp == appliedTimestamp_) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!textRenderer_->goCue(message.cueId, message.stateHash)) {
+        // Joined after the preload, or lost it - the snapshot carries the text
+        LT_LOG_WARNING("GO for cue %u, which is not staged - requesting the sender's state", message.cueId);
+        cueMisses_++;
+        requestState(start);
+        return;
+    }
+    cueGoUs_ = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    cuesTaken_++;
+
+    appliedRevision_ = message.revision;
+    appliedTimestamp_ = message.timestamp;
+    currentText_ = textRenderer_->getText();
+    currentSize_ = message.size;
+
+    // Kept and reported like any text update
+    TextMessage state(currentText_, currentSize_);
+    state.revision = message.revision;
+    state.stateHash = message.stateHash;
+    state.timestamp = message.timestamp;
+    stateStore_.save(state);
+    reportFit(state);
+    markInStep("cue taken");
+}
+
+void RenderThread::reportFit(const TextMessage& update) {
+    // Tell the sender if this text had to be wrapped or shrunk
+    if (feedbackCallback_) {
+        const TextFit& fit = textRenderer_->getFit();
+        feedbackCallback_(TextMessage::createFitReport(update, fit.scale,
+                                                       static_cast<int>(fit.lines.size()), getFitFlags()));
+    }
+}
+
+void RenderThread::handleStateRefresh(const TextMessage& message) {
+    // The screen is about to change - the next refresh checks it
+    if (!scheduled_.empty()) {
+        return;
+    }
+
+    // Describes an older state than the screen's - overtaken by an update on the other feed.
+    // Timestamps rather than revisions, so a restarted sender (revision 0 again) still counts as newer.
+    if (message.timestamp < appliedTimestamp_) {
+        return;
+    }
+
+    if (TextMessage::hashState(currentText_, currentSize_) == message.stateHash) {
+        appliedRevision_ = message.revision;
+        refreshesMatched_++;
+        markInStep(restoredState_ ? "restored state confirmed" : "refresh matched");
+        return;
+    }
+
+    if (message.stateFlags & STATE_HAS_TEXT) {
+        LT_LOG_INFO("State refresh: screen differs from sender revision %u - repairing", message.revision);
+        TextMessage state = message;
+        bool clear = state.textLength == 0 || (state.stateFlags & STATE_FADING);
+        state.type = clear ? MessageType::CLEAR_TEXT : MessageType::TEXT_UPDATE;
+        applyState(state);
+        stateRepairs_++;
+        markInStep("snapshot applied");
+        return;
+    }
+
+    // Compact refresh - ask for the text
+    LT_LOG_INFO("State refresh: screen differs from sender revision %u - requesting it", message.revision);
+    requestState(std::chrono::steady_clock::now());
+}
+
+void RenderThread::markInStep(const char* reason) {
+    if (!inStep_) {
+        inStep_ = true;
+        inStepReason_ = reason;
+    }
+}
+
+void RenderThread::requestState(std::chrono::steady_clock::time_point now) {
+    // At most every STATE_REQUEST_INTERVAL_MS - a lost request or reply is simply asked again
+    if (feedbackCallback_ && now - lastStateRequest_ >= std::chrono::milliseconds(STATE_REQUEST_INTERVAL_MS)) {
+        feedbackCallback_(TextMessage::createStateRequest(appliedRevision_));
+        lastStateRequest_ = now;
+        stateRequests_++;
+    }
+}
+
+uint8_t RenderThread::getFitFlags() const {
+    const TextFit& fit = textRenderer_->getFit();
+    return (fit.wrapped ? FIT_WRAPPED : 0) | (fit.shrunk ? FIT_SHRUNK : 0) | (fit.clipped ? FIT_CLIPPED : 0);
+}
+
+void RenderThread::renderFrame() {
+    auto frameStart = std::chrono::steady_clock::now();
+
+    LT_LOG_TRACE("RenderThread::renderFrame - currentSize=%s, currentText='%s'",
+                 currentSize_ == TextSize::SMALL ? "SMALL" : "BIG", currentText_);
+
+    profiler_.beginFrame();
+
+    // Render text with current size (TextRenderer handles fade internally)
+    profiler_.beginPass(PASS_TEXT);
+    textRenderer_->render();
+    profiler_.endPass(PASS_TEXT);
+
+    // Always send to both outputs - active gets the latest completed frame, inactive gets blank.
+    // The swap chain fences each frame, so no glFinish is needed before sharing it.
+    OutputSwapChain* swapChain = textRenderer_->getSwapChain();
+    TextureSender* activeSender = textureSenderSmall_.get();
+    TextureSender* inactiveSender = textureSenderBig_.get();
+    int activeConsumer = swapConsumerSmall_;
+    if (currentSize_ == TextSize::BIG) {
+        std::swap(activeSender, inactiveSender);
+        activeConsumer = swapConsumerBig_;
+    }
+
+    profiler_.beginPass(PASS_SEND);
+    OutputSwapChain::Frame frame = swapChain->acquireLatest(activeConsumer);
+    if (frame.texture > 0) {
+        activeSender->sendTexture(frame.texture, outputWidth_, outputHeight_);
+    }
+    swapChain->release(activeConsumer);
+    profiler_.endPass(PASS_SEND);
+
+    profiler_.beginPass(PASS_BLANK);
+    inactiveSender->sendTexture(blankTexture_, outputWidth_, outputHeight_);
+    profiler_.endPass(PASS_BLANK);
+
+    if (preview_) {
+        preview_->poll();
+        if (preview_->isDue()) {
+            profiler_.beginPass(PASS_PREVIEW);
+            OutputSwapChain::Frame previewFrame = swapChain->acquireLatest(swapConsumerPreview_);
+            preview_->update(previewFrame.texture);
+            swapChain->release(swapConsumerPreview_);
+            profiler_.endPass(PASS_PREVIEW);
+        }
+    }
+
+    double frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+    framesRendered_++;
+    renderTimeTotalMs_ += frameMs;
+    if (frameMs > renderTimeMaxMs_) {
+        renderTimeMaxMs_ = frameMs;
+    }
+}
+
+void RenderThread::publishStatus() {
+    RenderStatus& status = status_.writeBuffer();
+    status.framesRendered = framesRendered_;
+    status.renderAvgMs = framesRendered_ ? renderTimeTotalMs_ / framesRendered_ : 0.0;
+    status.renderMaxMs = renderTimeMaxMs_;
+    status.currentSize = currentSize_;
+    status.revision = appliedRevision_;
+    status.refreshesMatched = refreshesMatched_;
+    status.stateRepairs = stateRepairs_;
+    status.stateRequests = stateRequests_;
+    status.restoredState = restoredState_;
+    status.inStep = inStep_;
+    status.correctFrameMs = correctFrameMs_;
+    status.stagedCues = textRenderer_->getStagedCueCount();
+    status.cuesTaken = cuesTaken_;
+    status.cueMisses = cueMisses_;
+    status.cueGoUs = cueGoUs_;
+    status.clockSynced = clockSync_.isSynced();
+    status.clockOffsetUs = clockSync_.getOffsetUs();
+    status.clockRttUs = clockSync_.getRttUs();
+    status.clockSamples = clockSync_.getSampleCount();
+    status.timedFlips = timedFlips_;
+    status.flipLateAvgUs = timedFlips_ ? static_cast<double>(flipLateTotalUs_) / timedFlips_ : 0.0;
+    status.flipLateMaxUs = static_cast<double>(flipLateMaxUs_);
+    status.scheduler = scheduler_->getStats();
+
+    status.small = smallInfo_;
+    status.small.readback = textureSenderSmall_->getReadbackStats();
+    status.big = bigInfo_;
+    status.big.readback = textureSenderBig_->getReadbackStats();
+
+    OutputSwapChain* swapChain = textRenderer_->getSwapChain();
+    size_t count = 0;
+    for (int id = 0; id < swapChain->getConsumerCount(); ++id) {
+        if (id == swapConsumerPreview_) {
+            continue;  // Throttled by design - its drops aren't an output problem
+        }
+        if (status.swapConsumers.size() <= count) {
+            status.swapConsumers.emplace_back();
+        }
+        status.swapConsumers[count].name = swapChain->getConsumerName(id);
+        status.swapConsumers[count].stats = swapChain->getStats(id);
+        count++;
+    }
+    status.swapConsumers.resize(count);
+
+    profiler_.getTimings(status.passTimings);
+
+    const TextFit& fit = textRenderer_->getFit();
+    status.fitScale = fit.scale;
+    status.fitLines = fit.lines.size();
+    status.fitFlags = getFitFlags();
+    status.layoutUs = fit.layoutUs;
+
+    if (preview_) {
+        status.previewTexture = preview_->getTexture();
+        status.previewWidth = preview_->getWidth();
+        status.previewHeight = preview_->getHeight();
+    }
+
+    status_.publish();
+}
+
+void RenderThread::printBenchmark(double wallSeconds) const {
+    if (framesRendered_ == 0) {
+        return;
+    }
+    printf("Frames: %llu, render CPU avg %.3f ms, max %.3f ms\n",
+           static_cast<unsigned long long>(framesRendered_),
+           renderTimeTotalMs_ / framesRendered_, renderTimeMaxMs_);
+    printf("Wall clock: %llu frames in %.2f s (%.1f fps)\n",
+           static_cast<unsigned long long>(framesRendered_), wallSeconds,
+           wallSeconds > 0.0 ? framesRendered_ / wallSeconds : 0.0);
+    std::vector<PassTiming> timings;
+    profiler_.getTimings(timings);
+    for (const auto& timing : timings) {
+        printf("  %-8s GPU avg %.3f ms max %.3f ms, CPU avg %.3f ms max %.3f ms (last %d frames)\n",
+               timing.name.c_str(), timing.gpuAvgMs, timing.gpuMaxMs, timing.cpuAvgMs, timing.cpuMaxMs,
+               GpuProfiler::HISTORY_FRAMES);
+    }
+    fflush(stdout);
+}
+
+void RenderThread::shutdownGL() {
+    profiler_.shutdown();
+
+    if (textureSenderSmall_) {
+        textureSenderSmall_->shutdown();
+        textureSenderSmall_.reset();
+    }
+
+    if (textureSenderBig_) {
+        textureSenderBig_->shutdown();
+        textureSenderBig_.reset();
+    }
+
+    if (preview_) {
+        preview_->shutdown();
+        preview_.reset();
+    }
+
+    if (textRenderer_) {
+        textRenderer_->shutdown();
+        textRenderer_.reset();
+    }
+
+    if (blankTexture_) {
+        glDeleteTextures(1, &blankTexture_);
+        blankTexture_ = 0;
+    }
+}
+
+} // namespace LiveText
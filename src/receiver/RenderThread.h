@@ -0,0 +1,214 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/ClockSync.h"
+#include "common/TextMessage.h"
+#include "common/TripleBuffer.h"
+#include "FrameScheduler.h"
+#include "GpuProfiler.h"
+#include "MessageMailbox.h"
+#include "OutputSwapChain.h"
+#include "PreviewRenderer.h"
+#include "ReceiverConfig.h"
+#include "ReceiverStateStore.h"
+#include "TextRenderer.h"
+#include "TextureSender.h"
+
+namespace LiveText {
+
+struct OutputStatus {
+    bool initialized = false;
+    std::string platformInfo;
+    bool hasReadback = false;
+    ReadbackStats readback;
+};
+
+struct SwapConsumerStatus {
+    std::string name;
+    SwapChainStats stats;
+};
+
+// Snapshot of the output pipeline, published by the render thread every frame
+struct RenderStatus {
+    uint64_t framesRendered = 0;
+    double renderAvgMs = 0.0;   // CPU time per frame since start
+    double renderMaxMs = 0.0;
+    TextSize currentSize = TextSize::SMALL;
+    SchedulerStats scheduler;
+    OutputStatus small;
+    OutputStatus big;
+    std::vector<SwapConsumerStatus> swapConsumers;  // Excludes the throttled preview consumer
+    std::vector<PassTiming> passTimings;            // Rolling CPU/GPU time per render pass
+    float fitScale = 1.0f;      // Layout of the current text in the safe area
+    size_t fitLines = 0;
+    uint8_t fitFlags = 0;       // FitFlags
+    double layoutUs = 0.0;      // Last wrap/fit time
+    uint32_t revision = 0;      // Sender revision of the state on screen
+    uint64_t refreshesMatched = 0;  // STATE_REFRESH hashes that agreed with the screen
+    uint64_t stateRepairs = 0;      // Mismatches fixed from a refresh carrying the text
+    uint64_t stateRequests = 0;     // Join and mismatch requests for a snapshot
+    bool restoredState = false;     // Started from the state file
+    bool inStep = false;            // Screen confirmed to match the sender
+    double correctFrameMs = 0.0;    // Launch to the first frame known to match the sender
+    size_t stagedCues = 0;          // Preloaded cues ready for a GO
+    uint64_t cuesTaken = 0;
+    uint64_t cueMisses = 0;         // GOs for cues that were not staged
+    double cueGoUs = 0.0;           // Last GO, message to state swapped
+    bool clockSynced = false;       // Sender clock offset known - updates go up at their presentation time
+    int64_t clockOffsetUs = 0;      // Sender clock minus ours
+    uint64_t clockRttUs = 0;        // Round trip behind the offset - it is good to half of this
+    size_t clockSamples = 0;
+    uint64_t timedFlips = 0;        // Updates put up at their presentation time
+    double flipLateAvgUs = 0.0;     // Frame start after the presentation time
+    double flipLateMaxUs = 0.0;
+    GLuint previewTexture = 0;  // Completed preview image, valid in contexts sharing with the render context
+    int previewWidth = 0;
+    int previewHeight = 0;
+};
+
+// Owns the output pipeline - text renderer, swap chain consumers, texture
+// senders and preview - and drives it from its own thread on its own GL
+// context, paced by the frame scheduler. Network threads feed it through a
+// lock-free mailbox and the UI reads it back through a lock-free status
+// snapshot, so neither can stall an output frame.
+class RenderThread {
+public:
+    using ContextCallback = std::function<void()>;
+    using FeedbackCallback = std::function<void(const TextMessage&)>;
+
+    explicit RenderThread(const ReceiverConfig& config);
+    ~RenderThread();
+
+    // Calling thread must have the render context current; creates all GL resources
+    // and puts the state from the state file, if any, on the outputs
+    bool initialize(int outputWidth, int outputHeight, bool enablePreview);
+
+    // makeCurrent/releaseCurrent bind the render context on the render thread
+    void start(ContextCallback makeCurrent, ContextCallback releaseCurrent);
+
+    // Joins the thread, which releases GL resources on its own context first.
+    // If the thread never started, the caller must have the render context current.
+    void stop();
+
+    // Set before start(). Called on the render thread with a FIT_REPORT for every text update or cue,
+    // a STATE_REQUEST while joining or when a refresh shows the screen is out of step, a CLOCK_PING
+    // now and then, and a PRESENT_REPORT for each update shown at its presentation time.
+    void setFeedbackCallback(FeedbackCallback callback) { feedbackCallback_ = std::move(callback); }
+
+    // Any thread
+    void post(const TextMessage& message, int feedId);
+
+    // Any thread: a CLOCK_PONG, straight from the network thread so the round trip
+    // is timed when it arrives rather than when the next frame starts
+    void onClockPong(const TextMessage& pong) { clockSync_.onPong(pong); }
+    bool isFinished() const { return finished_; }
+
+    // Single reader (UI thread): refresh and read the latest snapshot
+    bool updateStatus() { return status_.update(); }
+    const RenderStatus& getStatus() const { return status_.read(); }
+
+    // Any thread: per-pass timing samples resolved since the last call (timing export)
+    void takeTimingSamples(std::vector<GpuTimingSample>& out) { profiler_.takeSamples(out); }
+
+private:
+    ReceiverConfig config_;
+    int outputWidth_, outputHeight_;
+
+    // Output pipeline - only touched on the render thread after start()
+    std::unique_ptr<TextRenderer> textRenderer_;
+    std::unique_ptr<TextureSender> textureSenderSmall_;  // Syphon output for small text
+    std::unique_ptr<TextureSender> textureSenderBig_;    // Syphon output for big text
+    std::unique_ptr<PreviewRenderer> preview_;
+    GLuint blankTexture_;  // Blank texture for clearing inactive outputs
+    int swapConsumerSmall_;
+    int swapConsumerBig_;
+    int swapConsumerPreview_;
+    OutputStatus smallInfo_;  // Static parts of the status, filled at initialize
+    OutputStatus bigInfo_;
+
+    std::string currentText_;
+    TextSize currentSize_;
+
+    // Sender state the screen shows, checked against each STATE_REFRESH and kept in the state file
+    ReceiverStateStore stateStore_;
+    uint32_t appliedRevision_;
+    uint64_t appliedTimestamp_;
+    uint64_t refreshesMatched_;
+    uint64_t stateRepairs_;
+    uint64_t stateRequests_;
+    std::chrono::steady_clock::time_point lastStateRequest_;
+    static constexpr int STATE_REQUEST_INTERVAL_MS = 500;    // Refreshes arrive on both feeds
+
+    // Late join: ask for a snapshot until the screen is known to match the sender
+    bool restoredState_;
+    bool inStep_;
+    const char* inStepReason_;      // Set when inStep_ turns true, cleared once reported
+    double correctFrameMs_;
+
+    // Cue GOs - the cues themselves are staged in the text renderer
+    uint64_t cuesTaken_;
+    uint64_t cueMisses_;
+    double cueGoUs_;
+
+    // Presentation times: updates wait here for the first frame at or after theirs
+    struct ScheduledUpdate {
+        TextMessage message;
+        uint64_t presentAt;     // Our clock, 0 = next frame
+    };
+    ClockSync clockSync_;
+    std::deque<ScheduledUpdate> scheduled_;
+    std::chrono::steady_clock::time_point lastClockPing_;
+    uint32_t lastPresentedRevision_;
+    uint64_t timedFlips_;
+    uint64_t flipLateTotalUs_;
+    uint64_t flipLateMaxUs_;
+    static constexpr int CLOCK_PING_FAST_MS = 100;      // Until the sample window is full
+    static constexpr int CLOCK_PING_INTERVAL_MS = 1000; // Then enough to follow drift
+    static constexpr int MAX_PRESENT_AHEAD_MS = 2000;   // Further out means a bad clock estimate - show it now
+
+    // Threading
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::atomic<bool> finished_;
+    ContextCallback makeCurrent_;
+    ContextCallback releaseCurrent_;
+    FeedbackCallback feedbackCallback_;
+
+    std::unique_ptr<FrameScheduler> scheduler_;
+    MessageMailbox mailbox_;
+    std::vector<MessageMailbox::Entry> pendingMessages_;
+    TripleBuffer<RenderStatus> status_;
+
+    // Frame timing
+    enum Pass { PASS_TEXT, PASS_SEND, PASS_BLANK, PASS_PREVIEW };
+    GpuProfiler profiler_;
+    uint64_t framesRendered_;
+    double renderTimeTotalMs_;
+    double renderTimeMaxMs_;
+
+    void threadMain();
+    void processMailbox();
+    void handleMessage(const TextMessage& message, int feedId);
+    void scheduleUpdate(const TextMessage& message);
+    void presentDue(uint64_t frameTime);
+    void pingClock(std::chrono::steady_clock::time_point now);
+    void applyState(const TextMessage& message);
+    void applyCue(const TextMessage& message);
+    void reportFit(const TextMessage& update);
+    void handleStateRefresh(const TextMessage& message);
+    void markInStep(const char* reason);
+    void requestState(std::chrono::steady_clock::time_point now);
+    uint8_t getFitFlags() const;
+    void renderFrame();
+    void publishStatus();
+    void printBenchmark(double wallSeconds) const;
+    void shutdownGL();
+};
+
+} // namespace LiveText
@@ -0,0 +1,171 @@
+#include "ShmFrameServer.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef __linux__
+#include <climits>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace LiveText {
+
+ShmFrameServer::ShmFrameServer()
+    : fd_(-1)
+    , mapping_(nullptr)
+    , mappingSize_(0)
+    , header_(nullptr)
+    , slotData_(nullptr)
+    , framesPublished_(0)
+{
+}
+
+ShmFrameServer::~ShmFrameServer() {
+    shutdown();
+}
+
+#ifdef __linux__
+
+bool ShmFrameServer::initialize(const std::string& senderName, int width, int height) {
+    if (header_) {
+        return true;
+    }
+
+    senderName_ = senderName;
+    segmentName_ = ShmFrame::segmentName(senderName);
+
+    uint32_t stride = static_cast<uint32_t>(width) * 4;  // RGBA8
+    mappingSize_ = ShmFrame::mappingSize(stride, static_cast<uint32_t>(height));
+
+    fd_ = shm_open(segmentName_.c_str(), O_CREAT | O_RDWR, 0666);
+    if (fd_ < 0) {
+        std::cerr << "Failed to create shared memory segment " << segmentName_
+                  << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    if (ftruncate(fd_, static_cast<off_t>(mappingSize_)) != 0) {
+        std::cerr << "Failed to size shared memory segment " << segmentName_
+                  << ": " << std::strerror(errno) << std::endl;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    mapping_ = mmap(nullptr, mappingSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+        std::cerr << "Failed to map shared memory segment " << segmentName_
+                  << ": " << std::strerror(errno) << std::endl;
+        mapping_ = nullptr;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    // Clients check the magic last, so publish it only once the layout is filled in
+    auto* header = static_cast<ShmFrame::RingHeader*>(mapping_);
+    std::memset(static_cast<void*>(header), 0, sizeof(ShmFrame::RingHeader));
+    header->version = ShmFrame::VERSION;
+    header->width = static_cast<uint32_t>(width);
+    header->height = static_cast<uint32_t>(height);
+    header->stride = stride;
+    header->format = ShmFrame::PixelFormat::RGBA8;
+    header->flags = ShmFrame::FLAG_BOTTOM_UP;
+    header->slotCount = ShmFrame::SLOT_COUNT;
+    header->slotSize = ShmFrame::slotSize(stride, static_cast<uint32_t>(height));
+    header->dataOffset = ShmFrame::headerSize();
+    header->writerPid = static_cast<uint32_t>(getpid());
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = ShmFrame::MAGIC;
+
+    header_ = header;
+    slotData_ = static_cast<uint8_t*>(mapping_) + header_->dataOffset;
+    framesPublished_ = 0;
+
+    std::cout << "Shared memory frame server ready: /dev/shm" << segmentName_ << " ("
+              << width << "x" << height << ", " << (mappingSize_ / (1024 * 1024)) << " MB)" << std::endl;
+    return true;
+}
+
+void ShmFrameServer::shutdown() {
+    if (header_) {
+        // Let clients notice the writer went away instead of waiting on a dead ring
+        header_->magic = 0;
+        header_->futexWord.fetch_add(1, std::memory_order_release);
+        wakeClients();
+        header_ = nullptr;
+        slotData_ = nullptr;
+    }
+    if (mapping_) {
+        munmap(mapping_, mappingSize_);
+        mapping_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+        shm_unlink(segmentName_.c_str());
+    }
+}
+
+void ShmFrameServer::onFrame(const CpuFrame& frame) {
+    if (!header_) {
+        return;
+    }
+    if (static_cast<uint32_t>(frame.width) != header_->width ||
+        static_cast<uint32_t>(frame.height) != header_->height ||
+        frame.size > header_->slotSize) {
+        return;
+    }
+
+    uint32_t slotIndex = (header_->latestSlot.load(std::memory_order_relaxed) + 1) % ShmFrame::SLOT_COUNT;
+    ShmFrame::SlotHeader& slot = header_->slots[slotIndex];
+
+    // Seqlock write: odd sequence while the pixels are in flux
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(slotData_ + slotIndex * header_->slotSize, frame.data, frame.size);
+    slot.frameCounter = frame.frameNumber;
+    slot.timestampUs = frame.timestampUs;
+    slot.size = frame.size;
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+
+    header_->latestSlot.store(slotIndex, std::memory_order_release);
+    header_->latestFrame.store(frame.frameNumber, std::memory_order_release);
+    header_->futexWord.fetch_add(1, std::memory_order_release);
+    wakeClients();
+
+    framesPublished_++;
+}
+
+void ShmFrameServer::wakeClients() {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header_->futexWord),
+            FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+bool ShmFrameServer::initialize(const std::string& senderName, int, int) {
+    senderName_ = senderName;
+    std::cerr << "Shared memory frame server is only available on Linux" << std::endl;
+    return false;
+}
+
+void ShmFrameServer::shutdown() {
+}
+
+void ShmFrameServer::onFrame(const CpuFrame&) {
+}
+
+void ShmFrameServer::wakeClients() {
+}
+
+#endif
+
+} // namespace LiveText
@@ -0,0 +1,40 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include "FrameSink.h"
+#include "common/ShmFrameRing.h"
+
+namespace LiveText {
+
+// Linux texture-sharing backend: publishes read-back frames into a named
+// POSIX shared-memory ring (/dev/shm/<name>) and wakes waiting clients with a
+// futex. Runs as a FrameSink on the readback worker thread, so each frame is
+// a single memcpy straight out of the mapped PBO.
+class ShmFrameServer : public FrameSink {
+public:
+    ShmFrameServer();
+    ~ShmFrameServer() override;
+
+    bool initialize(const std::string& senderName, int width, int height);
+    void shutdown();
+    bool isInitialized() const { return header_ != nullptr; }
+
+    void onFrame(const CpuFrame& frame) override;
+    std::string getName() const override { return "shm:" + senderName_; }
+
+    uint64_t getFramesPublished() const { return framesPublished_.load(); }
+
+private:
+    std::string senderName_;
+    std::string segmentName_;
+    int fd_;
+    void* mapping_;
+    size_t mappingSize_;
+    ShmFrame::RingHeader* header_;
+    uint8_t* slotData_;
+    std::atomic<uint64_t> framesPublished_;
+
+    void wakeClients();
+};
+
+} // namespace LiveText
@@ -0,0 +1,178 @@
+#include "TextLayout.h"
+#include <chrono>
+
+namespace LiveText {
+
+TextLayout::TextLayout() {
+    advances_.fill(0.0f);
+}
+
+void TextLayout::setAdvances(const std::array<float, 128>& advances) {
+    advances_ = advances;
+}
+
+float TextLayout::advance(char c) const {
+    // Non-ASCII bytes have no glyph and take no space, as in the renderer
+    return (c >= 0) ? advances_[static_cast<unsigned char>(c)] : 0.0f;
+}
+
+void TextLayout::measure(const std::string& text) {
+    words_.clear();
+    bool paragraphStart = true;
+    float gap = 0.0f;
+    size_t gapBegin = 0;
+
+    size_t i = 0;
+    while (i < text.size()) {
+        char c = text[i];
+        if (c == '\n') {
+            // An empty paragraph still takes a line
+            if (paragraphStart) {
+                words_.push_back({i, i, i, 0.0f, 0.0f, true});
+            }
+            paragraphStart = true;
+            gap = 0.0f;
+            gapBegin = ++i;
+        } else if (c == ' ') {
+            gap += advance(c);
+            ++i;
+        } else {
+            Word word = {gapBegin, i, i, 0.0f, gap, paragraphStart};
+            while (i < text.size() && text[i] != ' ' && text[i] != '\n') {
+                word.width += advance(text[i]);
+                ++i;
+            }
+            word.end = i;
+            words_.push_back(word);
+            paragraphStart = false;
+            gap = 0.0f;
+            gapBegin = i;
+        }
+    }
+    if (!text.empty() && text.back() == '\n') {
+        words_.push_back({text.size(), text.size(), text.size(), 0.0f, 0.0f, true});
+    }
+}
+
+size_t TextLayout::wrap(const std::string& text, float maxWidth) {
+    lineStarts_.clear();
+    lineEnds_.clear();
+
+    bool open = false;
+    size_t start = 0;
+    size_t end = 0;
+    float width = 0.0f;
+
+    auto closeLine = [&]() {
+        if (open) {
+            lineStarts_.push_back(start);
+            lineEnds_.push_back(end);
+            open = false;
+        }
+    };
+
+    for (const Word& word : words_) {
+        if (word.paragraphStart) {
+            closeLine();
+            if (word.begin == word.end) {
+                lineStarts_.push_back(word.begin);
+                lineEnds_.push_back(word.end);
+                continue;
+            }
+        }
+
+        if (open) {
+            if (width + word.gapBefore + word.width <= maxWidth) {
+                width += word.gapBefore + word.width;
+                end = word.end;
+                continue;
+            }
+            closeLine();
+        }
+
+        // Leading spaces are kept only at the start of a paragraph, never after a wrap
+        float lead = word.paragraphStart ? word.gapBefore : 0.0f;
+        if (lead + word.width <= maxWidth) {
+            start = word.paragraphStart ? word.gapBegin : word.begin;
+            end = word.end;
+            width = lead + word.width;
+            open = true;
+            continue;
+        }
+
+        // A word wider than the line on its own is broken between characters
+        size_t pieceStart = word.begin;
+        float pieceWidth = 0.0f;
+        for (size_t i = word.begin; i < word.end; ++i) {
+            float charWidth = advance(text[i]);
+            if (pieceWidth > 0.0f && pieceWidth + charWidth > maxWidth) {
+                lineStarts_.push_back(pieceStart);
+                lineEnds_.push_back(i);
+                pieceStart = i;
+                pieceWidth = 0.0f;
+            }
+            pieceWidth += charWidth;
+        }
+        start = pieceStart;
+        end = word.end;
+        width = pieceWidth;
+        open = true;
+    }
+    closeLine();
+
+    return lineStarts_.size();
+}
+
+void TextLayout::fit(const std::string& text, float boxWidth, float boxHeight, float lineHeight, TextFit& result) {
+    auto start = std::chrono::steady_clock::now();
+
+    result.lines.clear();
+    result.scale = 1.0f;
+    result.wrapped = false;
+    result.shrunk = false;
+    result.clipped = false;
+
+    measure(text);
+    if (!words_.empty() && boxWidth > 0.0f && boxHeight > 0.0f) {
+        // At scale s the box holds boxWidth / s font pixels per line
+        auto fitsAt = [&](float scale) {
+            return wrap(text, boxWidth / scale) * lineHeight * scale <= boxHeight;
+        };
+
+        if (!fitsAt(1.0f)) {
+            if (!fitsAt(MIN_SCALE)) {
+                result.scale = MIN_SCALE;
+                result.clipped = true;
+            } else {
+                // Line count only grows as the scale grows, so the fitting scales form one interval
+                float low = MIN_SCALE;
+                float high = 1.0f;
+                for (int step = 0; step < SEARCH_STEPS; ++step) {
+                    float mid = 0.5f * (low + high);
+                    if (fitsAt(mid)) {
+                        low = mid;
+                    } else {
+                        high = mid;
+                    }
+                }
+                result.scale = low;
+            }
+            result.shrunk = true;
+        }
+
+        size_t paragraphs = 0;
+        for (const Word& word : words_) {
+            paragraphs += word.paragraphStart ? 1 : 0;
+        }
+        size_t lineCount = wrap(text, boxWidth / result.scale);
+        result.wrapped = lineCount > paragraphs;
+        result.lines.reserve(lineCount);
+        for (size_t i = 0; i < lineCount; ++i) {
+            result.lines.emplace_back(text, lineStarts_[i], lineEnds_[i] - lineStarts_[i]);
+        }
+    }
+
+    result.layoutUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace LiveText
@@ -0,0 +1,59 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace LiveText {
+
+// Result of fitting text into a box
+struct TextFit {
+    std::vector<std::string> lines;
+    float scale = 1.0f;     // Shrink factor applied on top of the size's base scale
+    bool wrapped = false;   // At least one line was broken to fit the width
+    bool shrunk = false;    // scale < 1
+    bool clipped = false;   // Still too big at MIN_SCALE - drawn at MIN_SCALE and overflows
+    double layoutUs = 0.0;
+};
+
+// Word-wrap and fit-to-box for one font size, from cached glyph advances.
+//
+// Words and the gaps between them are measured once per text; the largest
+// scale that fits is then found by binary search, each probe being one
+// greedy wrap over the word list. No glyph or GL access, so a refit costs
+// microseconds and can run on every keystroke.
+class TextLayout {
+public:
+    static constexpr float MIN_SCALE = 0.25f;
+    static constexpr int SEARCH_STEPS = 12;    // Scale resolution of (1 - MIN_SCALE) / 4096
+
+    TextLayout();
+
+    // Pen advance in pixels for ASCII codes 0-127 (0 for glyphs the font lacks)
+    void setAdvances(const std::array<float, 128>& advances);
+
+    // Box and line height are in unscaled font pixels. '\n' always breaks.
+    void fit(const std::string& text, float boxWidth, float boxHeight, float lineHeight, TextFit& result);
+
+private:
+    struct Word {
+        size_t gapBegin;        // Start of the spaces before the word
+        size_t begin, end;      // Byte range in the text
+        float width;
+        float gapBefore;        // Width of the spaces between this word and the previous one
+        bool paragraphStart;    // First word after a '\n' (or of the text)
+    };
+
+    std::array<float, 128> advances_;
+    std::vector<Word> words_;
+    std::vector<size_t> lineStarts_;
+    std::vector<size_t> lineEnds_;
+
+    float advance(char c) const;
+    void measure(const std::string& text);
+
+    // Greedy wrap at maxWidth; fills lineStarts_/lineEnds_ and returns the line count
+    size_t wrap(const std::string& text, float maxWidth);
+};
+
+} // namespace LiveText
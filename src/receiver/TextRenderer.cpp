@@ -1,5 +1,10 @@
 #include "TextRenderer.h"
+#include "common/Logger.h"
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -7,18 +12,19 @@
 namespace LiveText {
 
 TextRenderer::TextRenderer()
-    : ft_(nullptr)
-    , faceSmall_(nullptr)
-    , faceBig_(nullptr)
-    , VAO_(0)
+    : VAO_(0)
     , VBO_(0)
+    , atlasTexture_(0)
+    , vboCapacity_(0)
     , shaderProgram_(0)
-    , frameBuffer_(0)
-    , colorTexture_(0)
-    , depthBuffer_(0)
+    , safeArea_(0.9f)
+    , ascentSmall_(SMALL_FONT_SIZE)
+    , ascentBig_(BIG_FONT_SIZE)
     , currentSize_(TextSize::SMALL)
     , fadeAlpha_(0.0f)
     , isFading_(false)
+    , liveCue_(-1)
+    , cueUseCounter_(0)
     , windowWidth_(1920)
     , windowHeight_(1080)
 {
@@ -32,12 +38,6 @@ bool TextRenderer::initialize(int windowWidth, int windowHeight) {
     windowWidth_ = windowWidth;
     windowHeight_ = windowHeight;
 
-    // Initialize FreeType
-    if (FT_Init_FreeType(&ft_)) {
-        std::cerr << "Could not init FreeType Library" << std::endl;
-        return false;
-    }
-
     // Load ABF font - try project font first, then fallbacks
     std::vector<std::string> fontPaths = {
         "fonts/ABF.ttf",
@@ -60,8 +60,7 @@ bool TextRenderer::initialize(int windowWidth, int windowHeight) {
 
     bool fontLoaded = false;
     for (const auto& fontPath : fontPaths) {
-        if (loadFont(fontPath, SMALL_FONT_SIZE, faceSmall_, charactersSmall_) &&
-            loadFont(fontPath, BIG_FONT_SIZE, faceBig_, charactersBig_)) {
+        if (loadFont(fontPath)) {
             fontLoaded = true;
             std::cout << "Loaded font: " << fontPath << std::endl;
             break;
@@ -85,15 +84,17 @@ bool TextRenderer::initialize(int windowWidth, int windowHeight) {
     glGenBuffers(1, &VBO_);
     glBindVertexArray(VAO_);
     glBindBuffer(GL_ARRAY_BUFFER, VBO_);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, nullptr, GL_DYNAMIC_DRAW);
+    vboCapacity_ = 256 * 24;
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vboCapacity_, nullptr, GL_DYNAMIC_DRAW);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), 0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
-    // Create frame buffer for rendering to texture
-    if (!createFrameBuffer()) {
-        std::cerr << "Failed to create frame buffer" << std::endl;
+    // Create the output swap chain for rendering to texture
+    swapChain_ = std::make_unique<OutputSwapChain>();
+    if (!swapChain_->initialize(windowWidth_, windowHeight_)) {
+        std::cerr << "Failed to create output swap chain" << std::endl;
         return false;
     }
 
@@ -102,17 +103,10 @@ bool TextRenderer::initialize(int windowWidth, int windowHeight) {
 
 void TextRenderer::shutdown() {
     // Cleanup OpenGL objects
-    if (frameBuffer_) {
-        glDeleteFramebuffers(1, &frameBuffer_);
-        frameBuffer_ = 0;
-    }
-    if (colorTexture_) {
-        glDeleteTextures(1, &colorTexture_);
-        colorTexture_ = 0;
-    }
-    if (depthBuffer_) {
-        glDeleteRenderbuffers(1, &depthBuffer_);
-        depthBuffer_ = 0;
+    releaseCues();
+    if (swapChain_) {
+        swapChain_->shutdown();
+        swapChain_.reset();
     }
     if (VAO_) {
         glDeleteVertexArrays(1, &VAO_);
@@ -127,97 +121,76 @@ void TextRenderer::shutdown() {
         shaderProgram_ = 0;
     }
 
-    // Cleanup character textures
-    for (auto& pair : charactersSmall_) {
-        glDeleteTextures(1, &pair.second.textureID);
-    }
-    for (auto& pair : charactersBig_) {
-        glDeleteTextures(1, &pair.second.textureID);
+    if (atlasTexture_) {
+        glDeleteTextures(1, &atlasTexture_);
+        atlasTexture_ = 0;
     }
     charactersSmall_.clear();
     charactersBig_.clear();
-
-    // Cleanup FreeType
-    if (faceSmall_) {
-        FT_Done_Face(faceSmall_);
-        faceSmall_ = nullptr;
-    }
-    if (faceBig_) {
-        FT_Done_Face(faceBig_);
-        faceBig_ = nullptr;
-    }
-    if (ft_) {
-        FT_Done_FreeType(ft_);
-        ft_ = nullptr;
-    }
 }
 
 void TextRenderer::updateText(const std::string& text, TextSize size) {
-    std::cout << "TextRenderer::updateText - text='" << text << "', size=" << (size == TextSize::SMALL ? "SMALL" : "BIG") << std::endl;
+    LT_LOG_DEBUG("TextRenderer::updateText - text='%s', size=%s", text, size == TextSize::SMALL ? "SMALL" : "BIG");
     if (currentText_ != text || currentSize_ != size) {
         currentText_ = text;
         currentSize_ = size;
+        relayout();
         cachedText_.isDirty = true;  // Mark cache as dirty
-        std::cout << "TextRenderer::updateText - text/size changed, cache marked dirty" << std::endl;
+        LT_LOG_DEBUG("TextRenderer::updateText - text/size changed, cache marked dirty");
     }
+    liveCue_ = -1;
     fadeAlpha_ = 1.0f;
     isFading_ = false;
-    std::cout << "TextRenderer::updateText - fadeAlpha=" << fadeAlpha_ << ", isFading=" << isFading_ << std::endl;
+    LT_LOG_DEBUG("TextRenderer::updateText - fadeAlpha=%g, isFading=%d", fadeAlpha_, isFading_);
 }
 
-void TextRenderer::clearText() {
+void TextRenderer::clearText(float alreadyElapsedSeconds) {
     if (!currentText_.empty() || fadeAlpha_ > 0.01f) {
-        std::cout << "Starting fade-out animation on receiver with text: '" << currentText_ << "'" << std::endl;
+        LT_LOG_DEBUG("Starting fade-out animation on receiver with text: '%s'", currentText_);
         isFading_ = true;
-        fadeStartTime_ = std::chrono::steady_clock::now();
+        fadeStartTime_ = std::chrono::steady_clock::now() -
+                         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                             std::chrono::duration<float>(alreadyElapsedSeconds));
     }
 }
 
 void TextRenderer::render() {
     updateFade();
 
-    std::cout << "TextRenderer::render - currentText='" << currentText_ << "', fadeAlpha=" << fadeAlpha_
-              << ", isFading=" << isFading_ << ", isEmpty=" << currentText_.empty() << std::endl;
+    LT_LOG_TRACE("TextRenderer::render - currentText='%s', fadeAlpha=%g, isFading=%d, isEmpty=%d",
+                 currentText_, fadeAlpha_, isFading_, currentText_.empty());
 
-    // Always render to framebuffer (even if empty) so Syphon gets a valid texture
-    // Bind framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
+    // Always render a frame (even if empty) so Syphon gets a valid texture
+    // Bind a free swap chain buffer - never one an output is still reading
+    GLuint target = swapChain_->acquireBackBuffer();
+    if (target == 0) {
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, target);
     glViewport(0, 0, windowWidth_, windowHeight_);
 
-    // Clear with transparent black
-    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
-
-    // Only render text if we have something to show
-    if (!currentText_.empty() || fadeAlpha_ > 0.01f) {
-        // Enable blending
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        // Use shader
-        glUseProgram(shaderProgram_);
-
-        // Set projection matrix (orthographic)
-        glm::mat4 projection = glm::ortho(0.0f, static_cast<GLfloat>(windowWidth_),
-                                         0.0f, static_cast<GLfloat>(windowHeight_));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram_, "projection"), 1, GL_FALSE,
-                          glm::value_ptr(projection));
-
-        // Set text color (white)
-        glUniform3f(glGetUniformLocation(shaderProgram_, "textColor"), 1.0f, 1.0f, 1.0f);
-        glUniform1f(glGetUniformLocation(shaderProgram_, "alpha"), fadeAlpha_);
-
-        // Update cache if needed and render
-        updateTextCache();
-        renderCachedText();
-
-        // Cleanup
-        glBindVertexArray(0);
-        glUseProgram(0);
-        glDisable(GL_BLEND);
+    if (liveCue_ >= 0 && !isFading_) {
+        // A staged cue is already the finished frame - copy it over the whole buffer
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, cueSlots_[liveCue_].frameBuffer);
+        glBlitFramebuffer(0, 0, windowWidth_, windowHeight_, 0, 0, windowWidth_, windowHeight_,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    } else {
+        // Clear with transparent black
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // Only render text if we have something to show
+        if (!currentText_.empty() || fadeAlpha_ > 0.01f) {
+            // Update cache if needed and render
+            beginTextPass(fadeAlpha_);
+            updateTextCache();
+            renderCachedText();
+            endTextPass();
+        }
     }
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    swapChain_->present();
 }
 
 void TextRenderer::setWindowSize(int width, int height) {
@@ -225,64 +198,115 @@ void TextRenderer::setWindowSize(int width, int height) {
         windowWidth_ = width;
         windowHeight_ = height;
 
-        // Recreate framebuffer with new size
-        if (frameBuffer_) {
-            glDeleteFramebuffers(1, &frameBuffer_);
-            glDeleteTextures(1, &colorTexture_);
-            glDeleteRenderbuffers(1, &depthBuffer_);
+        // Recreate swap chain buffers with new size
+        if (swapChain_) {
+            swapChain_->resize(width, height);
         }
-        createFrameBuffer();
+        releaseCues();  // Staged at the old size - the sender preloads them again
+        relayout();
+        cachedText_.isDirty = true;
     }
 }
 
-bool TextRenderer::loadFont(const std::string& fontPath, int fontSize, FT_Face& face, std::map<GLchar, Character>& characters) {
-    if (FT_New_Face(ft_, fontPath.c_str(), 0, &face)) {
-        return false;
-    }
+void TextRenderer::setSafeArea(float fraction) {
+    safeArea_ = std::max(0.1f, std::min(1.0f, fraction));
+    releaseCues();
+    relayout();
+    cachedText_.isDirty = true;
+}
 
-    FT_Set_Pixel_Sizes(face, 0, fontSize);
+void TextRenderer::relayout() {
+    layoutText(currentText_, currentSize_, fit_);
+}
 
-    // Disable byte-alignment restriction
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+void TextRenderer::layoutText(const std::string& text, TextSize size, TextFit& fit) {
+    // The box is in font pixels: the output safe area undone by the size's base scale
+    float baseScale = getBaseScale(size);
+    float fontSize = static_cast<float>(size == TextSize::BIG ? BIG_FONT_SIZE : SMALL_FONT_SIZE);
+    TextLayout& layout = (size == TextSize::BIG) ? layoutBig_ : layoutSmall_;
+    layout.fit(text, windowWidth_ * safeArea_ / baseScale, windowHeight_ * safeArea_ / baseScale,
+               fontSize, fit);
+    LT_LOG_DEBUG("TextRenderer::layoutText - %zu lines, scale %.3f%s%s in %.1f us", fit.lines.size(), fit.scale,
+                 fit.wrapped ? ", wrapped" : "", fit.clipped ? ", CLIPPED" : "", fit.layoutUs);
+}
 
-    // Load first 128 characters of ASCII set
-    for (GLubyte c = 0; c < 128; c++) {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-            continue;
-        }
+bool TextRenderer::loadFont(const std::string& fontPath) {
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    int maxWidth = std::min(GlyphAtlas::DEFAULT_WIDTH, static_cast<int>(maxTextureSize));
 
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer
-        );
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        Character character = {
-            texture,
-            static_cast<int>(face->glyph->bitmap.width),
-            static_cast<int>(face->glyph->bitmap.rows),
-            static_cast<int>(face->glyph->bitmap_left),
-            static_cast<int>(face->glyph->bitmap_top),
-            static_cast<GLuint>(face->glyph->advance.x)
-        };
-        characters.insert(std::pair<GLchar, Character>(c, character));
+    GlyphAtlas atlas;
+    if (!atlas.build(fontPath, {SMALL_FONT_SIZE, BIG_FONT_SIZE}, maxWidth)) {
+        return false;
+    }
+    atlasTexture_ = atlas.createTexture();
+    if (atlasTexture_ == 0) {
+        return false;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    float invWidth = 1.0f / atlas.getWidth();
+    float invHeight = 1.0f / atlas.getHeight();
+    std::map<GLchar, Character>* maps[] = {&charactersSmall_, &charactersBig_};
+    for (size_t sizeIndex = 0; sizeIndex < 2; ++sizeIndex) {
+        maps[sizeIndex]->clear();
+        for (int c = 0; c < GlyphAtlas::GLYPH_COUNT; ++c) {
+            const AtlasGlyph& glyph = atlas.getGlyph(sizeIndex, c);
+            if (!glyph.present) {
+                continue;
+            }
+            Character character = {
+                atlasTexture_,
+                glyph.x * invWidth,
+                glyph.y * invHeight,
+                (glyph.x + glyph.width) * invWidth,
+                (glyph.y + glyph.height) * invHeight,
+                glyph.width,
+                glyph.height,
+                glyph.bearingX,
+                glyph.bearingY,
+                static_cast<GLuint>(glyph.advance)
+            };
+            maps[sizeIndex]->insert(std::pair<GLchar, Character>(static_cast<GLchar>(c), character));
+        }
+    }
+    atlas.releasePixels();
+
+    // Layout advances match getTextWidth: missing glyphs measure as a space
+    TextLayout* layouts[] = {&layoutSmall_, &layoutBig_};
+    int* ascents[] = {&ascentSmall_, &ascentBig_};
+    for (size_t sizeIndex = 0; sizeIndex < 2; ++sizeIndex) {
+        const std::map<GLchar, Character>& characters = *maps[sizeIndex];
+        *ascents[sizeIndex] = 0;
+        for (const auto& pair : characters) {
+            *ascents[sizeIndex] = std::max(*ascents[sizeIndex], pair.second.bearingY);
+        }
+        auto space = characters.find(' ');
+        float spaceAdvance = (space != characters.end()) ? static_cast<float>(space->second.advance >> 6) : 0.0f;
+        std::array<float, 128> advances;
+        for (int c = 0; c < 128; ++c) {
+            auto it = characters.find(static_cast<GLchar>(c));
+            advances[c] = (it != characters.end()) ? static_cast<float>(it->second.advance >> 6) : spaceAdvance;
+        }
+        layouts[sizeIndex]->setAdvances(advances);
+    }
+
+    const GlyphAtlasStats& stats = atlas.getStats();
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2)
+           << "Glyph atlas " << atlas.getWidth() << "x" << atlas.getHeight()
+           << (stats.cacheHit ? " (cache hit)" : " (cache miss)")
+           << ": hash " << stats.hashMs << " ms";
+    if (stats.cacheHit) {
+        report << ", load " << stats.cacheLoadMs << " ms";
+    } else {
+        report << ", rasterize " << stats.glyphsRasterized << " glyphs in " << stats.rasterizeMs << " ms"
+               << " on " << stats.workers << (stats.workers == 1 ? " thread" : " threads")
+               << ", pack " << stats.packMs << " ms"
+               << ", write " << stats.cacheWriteMs << " ms";
+    }
+    report << ", upload " << stats.uploadMs << " ms";
+    std::cout << report.str() << std::endl;
+    std::cout << "Glyph cache: " << stats.cachePath << std::endl;
     return true;
 }
 
@@ -335,35 +359,6 @@ GLuint TextRenderer::createShaderProgram() {
     return program;
 }
 
-bool TextRenderer::createFrameBuffer() {
-    // Generate framebuffer
-    glGenFramebuffers(1, &frameBuffer_);
-    glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer_);
-
-    // Create color texture
-    glGenTextures(1, &colorTexture_);
-    glBindTexture(GL_TEXTURE_2D, colorTexture_);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, windowWidth_, windowHeight_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture_, 0);
-
-    // Create depth buffer
-    glGenRenderbuffers(1, &depthBuffer_);
-    glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer_);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, windowWidth_, windowHeight_);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer_);
-
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        std::cerr << "Framebuffer not complete!" << std::endl;
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        return false;
-    }
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    return true;
-}
-
 void TextRenderer::updateFade() {
     if (isFading_) {
         auto now = std::chrono::steady_clock::now();
@@ -373,6 +368,7 @@ void TextRenderer::updateFade() {
             fadeAlpha_ = 0.0f;
             isFading_ = false;
             currentText_.clear();
+            liveCue_ = -1;
         } else {
             // Exponential decay
             float progress = elapsed / FADE_DURATION_SECONDS;
@@ -404,13 +400,13 @@ void TextRenderer::renderText(const std::string& text, float x, float y, float s
 
         // Update VBO for each character
         GLfloat vertices[6][4] = {
-            { xpos,     ypos + h,   0.0, 0.0 },
-            { xpos,     ypos,       0.0, 1.0 },
-            { xpos + w, ypos,       1.0, 1.0 },
+            { xpos,     ypos + h,   ch.u0, ch.v0 },
+            { xpos,     ypos,       ch.u0, ch.v1 },
+            { xpos + w, ypos,       ch.u1, ch.v1 },
 
-            { xpos,     ypos + h,   0.0, 0.0 },
-            { xpos + w, ypos,       1.0, 1.0 },
-            { xpos + w, ypos + h,   1.0, 0.0 }
+            { xpos,     ypos + h,   ch.u0, ch.v0 },
+            { xpos + w, ypos,       ch.u1, ch.v1 },
+            { xpos + w, ypos + h,   ch.u1, ch.v0 }
         };
 
         glBindTexture(GL_TEXTURE_2D, ch.textureID);
@@ -453,45 +449,38 @@ float TextRenderer::getTextWidth(const std::string& text, const std::map<GLchar,
 }
 
 void TextRenderer::updateTextCache() {
-    std::cout << "TextRenderer::updateTextCache - isDirty=" << cachedText_.isDirty
-              << ", currentText='" << currentText_ << "', empty=" << currentText_.empty() << std::endl;
+    LT_LOG_TRACE("TextRenderer::updateTextCache - isDirty=%d, currentText='%s', empty=%d",
+                 cachedText_.isDirty, currentText_, currentText_.empty());
 
     if (!cachedText_.isDirty || currentText_.empty()) {
-        std::cout << "TextRenderer::updateTextCache - early return" << std::endl;
+        LT_LOG_TRACE("TextRenderer::updateTextCache - early return");
         return;
     }
 
     cachedText_.text = currentText_;
     cachedText_.size = currentSize_;
-    std::cout << "TextRenderer::updateTextCache - updating cache for text='" << currentText_ << "'" << std::endl;
-
-    // Choose character map based on size
-    const auto& characters = (currentSize_ == TextSize::BIG) ? charactersBig_ : charactersSmall_;
-    float scale = (currentSize_ == TextSize::BIG) ? 1.0f : 0.5f;
-    float lineHeight = (currentSize_ == TextSize::BIG ? BIG_FONT_SIZE : SMALL_FONT_SIZE) * scale;
-
-    // Split text into lines
-    std::vector<std::string> lines;
-    std::string currentLine;
-    for (char c : currentText_) {
-        if (c == '\n') {
-            lines.push_back(currentLine);
-            currentLine.clear();
-        } else {
-            currentLine += c;
-        }
-    }
-    if (!currentLine.empty() || (!currentText_.empty() && currentText_.back() == '\n')) {
-        lines.push_back(currentLine);
-    }
+    LT_LOG_DEBUG("TextRenderer::updateTextCache - updating cache for text='%s'", currentText_);
+
+    buildVertices(currentText_, currentSize_, fit_, cachedText_.vertices);
+    cachedText_.isDirty = false;
+}
+
+void TextRenderer::buildVertices(const std::string& text, TextSize size, const TextFit& fit,
+                                 std::vector<GLfloat>& vertexData) const {
+    // Choose character map based on size; lines come wrapped and scaled to the safe area
+    const auto& characters = (size == TextSize::BIG) ? charactersBig_ : charactersSmall_;
+    float scale = getBaseScale(size) * fit.scale;
+    float lineHeight = (size == TextSize::BIG ? BIG_FONT_SIZE : SMALL_FONT_SIZE) * scale;
+    const std::vector<std::string>& lines = fit.lines;
 
     // Calculate total text height for vertical centering
     float totalTextHeight = lineHeight * lines.size();
-    float startY = (windowHeight_ + totalTextHeight) / 2.0f - lineHeight;  // Start from top line
+    float ascent = (size == TextSize::BIG ? ascentBig_ : ascentSmall_) * scale;
+    float startY = (windowHeight_ + totalTextHeight) / 2.0f - ascent;  // Top line's baseline
 
     // Pre-calculate all vertices
-    cachedText_.vertices.clear();
-    cachedText_.vertices.reserve(currentText_.length() * 24);  // 6 vertices * 4 components per character
+    vertexData.clear();
+    vertexData.reserve(text.length() * 24);  // 6 vertices * 4 components per character
 
     // Render each line centered
     for (size_t lineIdx = 0; lineIdx < lines.size(); ++lineIdx) {
@@ -517,17 +506,17 @@ void TextRenderer::updateTextCache() {
 
                     // Add vertices for this character (2 triangles = 6 vertices)
                     GLfloat vertices[24] = {
-                        xpos,     ypos + h,   0.0f, 0.0f,
-                        xpos,     ypos,       0.0f, 1.0f,
-                        xpos + w, ypos,       1.0f, 1.0f,
+                        xpos,     ypos + h,   ch.u0, ch.v0,
+                        xpos,     ypos,       ch.u0, ch.v1,
+                        xpos + w, ypos,       ch.u1, ch.v1,
 
-                        xpos,     ypos + h,   0.0f, 0.0f,
-                        xpos + w, ypos,       1.0f, 1.0f,
-                        xpos + w, ypos + h,   1.0f, 0.0f
+                        xpos,     ypos + h,   ch.u0, ch.v0,
+                        xpos + w, ypos,       ch.u1, ch.v1,
+                        xpos + w, ypos + h,   ch.u1, ch.v0
                     };
 
                     for (int i = 0; i < 24; ++i) {
-                        cachedText_.vertices.push_back(vertices[i]);
+                        vertexData.push_back(vertices[i]);
                     }
 
                     currentX += (ch.advance >> 6) * scale;
@@ -535,59 +524,192 @@ void TextRenderer::updateTextCache() {
             }
         }
     }
-
-    cachedText_.isDirty = false;
 }
 
 void TextRenderer::renderCachedText() {
-    std::cout << "TextRenderer::renderCachedText - vertices.size()=" << cachedText_.vertices.size()
-              << ", text='" << cachedText_.text << "'" << std::endl;
+    LT_LOG_TRACE("TextRenderer::renderCachedText - vertices.size()=%zu, text='%s'",
+                 cachedText_.vertices.size(), cachedText_.text);
 
     if (cachedText_.vertices.empty()) {
-        std::cout << "TextRenderer::renderCachedText - early return (empty vertices)" << std::endl;
+        LT_LOG_TRACE("TextRenderer::renderCachedText - early return (empty vertices)");
         return;
     }
+    drawVertices(cachedText_.vertices);
+}
+
+void TextRenderer::beginTextPass(float alpha) {
+    // Enable blending
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // Use shader
+    glUseProgram(shaderProgram_);
 
+    // Set projection matrix (orthographic)
+    glm::mat4 projection = glm::ortho(0.0f, static_cast<GLfloat>(windowWidth_),
+                                     0.0f, static_cast<GLfloat>(windowHeight_));
+    glUniformMatrix4fv(glGetUniformLocation(shaderProgram_, "projection"), 1, GL_FALSE,
+                      glm::value_ptr(projection));
+
+    // Set text color (white)
+    glUniform3f(glGetUniformLocation(shaderProgram_, "textColor"), 1.0f, 1.0f, 1.0f);
+    glUniform1f(glGetUniformLocation(shaderProgram_, "alpha"), alpha);
+}
+
+void TextRenderer::drawVertices(const std::vector<GLfloat>& vertices) {
+    // Every glyph lives in the atlas, so the whole text is one upload and one draw
     glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture_);
     glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    if (vertices.size() > vboCapacity_) {
+        vboCapacity_ = vertices.size();
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vboCapacity_, nullptr, GL_DYNAMIC_DRAW);
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLfloat) * vertices.size(), vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Choose character map
-    const auto& characters = (cachedText_.size == TextSize::BIG) ? charactersBig_ : charactersSmall_;
+    GLsizei vertexCount = static_cast<GLsizei>(vertices.size() / 4);
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+    LT_LOG_TRACE("TextRenderer::drawVertices - rendered %d characters", vertexCount / 6);
 
-    // Render all characters using cached vertices
-    size_t vertexIndex = 0;
-    int charCount = 0;
-    for (char c : cachedText_.text) {
-        // Skip newlines - they don't have vertices
-        if (c == '\n') {
-            continue;
-        }
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
 
-        if (c >= 0 && c < 128) {
-            auto it = characters.find(static_cast<GLchar>(c));
-            if (it != characters.end()) {
-                const Character& ch = it->second;
+void TextRenderer::endTextPass() {
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glDisable(GL_BLEND);
+}
 
-                // Update VBO with pre-calculated vertices
-                glBindBuffer(GL_ARRAY_BUFFER, VBO_);
-                glBufferSubData(GL_ARRAY_BUFFER, 0, 24 * sizeof(GLfloat),
-                               &cachedText_.vertices[vertexIndex]);
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
+void TextRenderer::stageCue(uint32_t cueId, const std::string& text, TextSize size) {
+    uint32_t stateHash = TextMessage::hashState(text, size);
 
-                glBindTexture(GL_TEXTURE_2D, ch.textureID);
-                glDrawArrays(GL_TRIANGLES, 0, 6);
+    // Already staged (the sender preloads again for late joiners) - or staged with old text
+    StagedCue* slot = nullptr;
+    for (int i = 0; i < CUE_SLOTS; ++i) {
+        if (cueSlots_[i].cueId == cueId) {
+            if (cueSlots_[i].stateHash == stateHash) {
+                cueSlots_[i].lastUsed = ++cueUseCounter_;
+                return;
+            }
+            if (i == liveCue_) {
+                liveCue_ = -1;  // The screen keeps the old text from the cache until the next GO
+            }
+            slot = &cueSlots_[i];
+            break;
+        }
+    }
 
-                charCount++;
-                vertexIndex += 24;
-            } else {
-                std::cout << "TextRenderer::renderCachedText - character '" << c << "' not found in map!" << std::endl;
+    // Otherwise a free slot, or the least recently used one that is not on screen
+    if (!slot) {
+        for (int i = 0; i < CUE_SLOTS; ++i) {
+            if (i == liveCue_) {
+                continue;
+            }
+            if (!slot || cueSlots_[i].cueId == 0 || (slot->cueId != 0 && cueSlots_[i].lastUsed < slot->lastUsed)) {
+                slot = &cueSlots_[i];
+                if (slot->cueId == 0) {
+                    break;
+                }
             }
         }
     }
-    std::cout << "TextRenderer::renderCachedText - rendered " << charCount << " characters" << std::endl;
 
-    glBindVertexArray(0);
+    // The layout and glyph work a GO would otherwise do, done now
+    layoutText(text, size, slot->fit);
+    buildVertices(text, size, slot->fit, slot->vertices);
+
+    if (slot->frameBuffer || createCueTarget(*slot)) {
+        glBindFramebuffer(GL_FRAMEBUFFER, slot->frameBuffer);
+        glViewport(0, 0, windowWidth_, windowHeight_);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (!slot->vertices.empty()) {
+            beginTextPass(1.0f);
+            drawVertices(slot->vertices);
+            endTextPass();
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    slot->cueId = cueId;
+    slot->stateHash = stateHash;
+    slot->text = text;
+    slot->size = size;
+    slot->lastUsed = ++cueUseCounter_;
+    LT_LOG_DEBUG("TextRenderer::stageCue - cue %u staged, %zu lines", cueId, slot->fit.lines.size());
+}
+
+bool TextRenderer::goCue(uint32_t cueId, uint32_t stateHash) {
+    for (int i = 0; i < CUE_SLOTS; ++i) {
+        StagedCue& slot = cueSlots_[i];
+        if (slot.cueId != cueId || slot.stateHash != stateHash) {
+            continue;
+        }
+
+        // Copies only - the cache stays valid for a later fade-out, which draws glyphs
+        currentText_ = slot.text;
+        currentSize_ = slot.size;
+        fit_ = slot.fit;
+        cachedText_.text = slot.text;
+        cachedText_.size = slot.size;
+        cachedText_.vertices = slot.vertices;
+        cachedText_.isDirty = false;
+        fadeAlpha_ = 1.0f;
+        isFading_ = false;
+
+        liveCue_ = slot.frameBuffer ? i : -1;
+        slot.lastUsed = ++cueUseCounter_;
+        return true;
+    }
+    return false;
+}
+
+size_t TextRenderer::getStagedCueCount() const {
+    size_t count = 0;
+    for (const StagedCue& slot : cueSlots_) {
+        count += slot.cueId != 0 ? 1 : 0;
+    }
+    return count;
+}
+
+bool TextRenderer::createCueTarget(StagedCue& slot) {
+    // Same format as the swap chain buffers, so a blit is a straight copy
+    glGenFramebuffers(1, &slot.frameBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, slot.frameBuffer);
+    glGenTextures(1, &slot.texture);
+    glBindTexture(GL_TEXTURE_2D, slot.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, windowWidth_, windowHeight_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, slot.texture, 0);
     glBindTexture(GL_TEXTURE_2D, 0);
+
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        std::cerr << "Cue staging framebuffer not complete - staged cues will be drawn from glyphs" << std::endl;
+        glDeleteFramebuffers(1, &slot.frameBuffer);
+        glDeleteTextures(1, &slot.texture);
+        slot.frameBuffer = 0;
+        slot.texture = 0;
+    }
+    return complete;
+}
+
+void TextRenderer::releaseCues() {
+    for (StagedCue& slot : cueSlots_) {
+        if (slot.frameBuffer) {
+            glDeleteFramebuffers(1, &slot.frameBuffer);
+        }
+        if (slot.texture) {
+            glDeleteTextures(1, &slot.texture);
+        }
+        slot = StagedCue();
+    }
+    liveCue_ = -1;
 }
 
 } // namespace LiveText
\ No newline at end of file
@@ -8,18 +8,21 @@
 #else
 #include <GL/gl3w.h>
 #endif
-#include <ft2build.h>
-#include FT_FREETYPE_H
 #include <string>
 #include <map>
 #include <memory>
 #include <chrono>
+#include <vector>
 #include "common/TextMessage.h"
+#include "OutputSwapChain.h"
+#include "GlyphAtlas.h"
+#include "TextLayout.h"
 
 namespace LiveText {
 
 struct Character {
-    GLuint textureID;   // ID handle of the glyph texture
+    GLuint textureID;   // Shared glyph atlas texture
+    float u0, v0, u1, v1; // Glyph rectangle in the atlas
     int sizeX, sizeY;   // Size of glyph
     int bearingX, bearingY; // Offset from baseline to left/top of glyph
     GLuint advance;     // Offset to advance to next glyph
@@ -34,32 +37,54 @@ public:
     void shutdown();
 
     void updateText(const std::string& text, TextSize size);
-    void clearText();
+    void clearText(float alreadyElapsedSeconds = 0.0f);    // Joining mid-fade starts part way in
     void render();
 
     void setWindowSize(int width, int height);
 
-    // Get rendered texture for Spout
-    GLuint getRenderedTexture() const { return colorTexture_; }
+    // Fraction of the output width/height text is fitted into, centered (1.0 = full frame)
+    void setSafeArea(float fraction);
+
+    // How the current text was wrapped and scaled - updated by updateText and resizes
+    const TextFit& getFit() const { return fit_; }
+    const std::string& getText() const { return currentText_; }
+
+    // Cue staging: a preloaded cue is laid out and drawn into a framebuffer
+    // of its own when it arrives, so taking it is a state swap and each frame
+    // one blit - no layout or glyph work at the cut. CUE_SLOTS covers the
+    // live cue plus the sender's preload window; at 4K each slot is 33 MB.
+    static constexpr int CUE_SLOTS = 4;
+    void stageCue(uint32_t cueId, const std::string& text, TextSize size);
+    // False if the cue is not staged, or was staged with text other than stateHash describes
+    bool goCue(uint32_t cueId, uint32_t stateHash);
+    size_t getStagedCueCount() const;
+
+    // Get the most recently completed output texture
+    GLuint getRenderedTexture() const { return swapChain_ ? swapChain_->getLatestTexture() : 0; }
+
+    // Output swap chain - texture senders acquire/release frames through it
+    OutputSwapChain* getSwapChain() { return swapChain_.get(); }
     bool hasContent() const { return !currentText_.empty() || fadeAlpha_ > 0.01f; }
 
 private:
-    // FreeType
-    FT_Library ft_;
-    FT_Face faceSmall_;
-    FT_Face faceBig_;
-
     // OpenGL objects
     GLuint VAO_, VBO_;
+    GLuint atlasTexture_;       // Both sizes' glyphs - one bind, one draw per frame
+    size_t vboCapacity_;        // Floats the VBO can hold without reallocating
     GLuint shaderProgram_;
-    GLuint frameBuffer_;
-    GLuint colorTexture_;
-    GLuint depthBuffer_;
+    std::unique_ptr<OutputSwapChain> swapChain_;
 
     // Character maps for different font sizes
     std::map<GLchar, Character> charactersSmall_;
     std::map<GLchar, Character> charactersBig_;
 
+    // Wrap/fit from the same glyph advances
+    TextLayout layoutSmall_;
+    TextLayout layoutBig_;
+    TextFit fit_;
+    float safeArea_;
+    int ascentSmall_, ascentBig_;   // Tallest glyph above the baseline - places the first line
+
     // Current state
     std::string currentText_;
     TextSize currentSize_;
@@ -79,6 +104,22 @@ private:
         CachedTextData() : isDirty(true) {}
     } cachedText_;
 
+    // Pre-rendered cues, least recently staged or taken replaced first
+    struct StagedCue {
+        uint32_t cueId = 0;     // 0 = free
+        uint32_t stateHash = 0;
+        std::string text;
+        TextSize size = TextSize::SMALL;
+        TextFit fit;
+        std::vector<GLfloat> vertices;
+        GLuint frameBuffer = 0;
+        GLuint texture = 0;
+        uint64_t lastUsed = 0;
+    };
+    StagedCue cueSlots_[CUE_SLOTS];
+    int liveCue_;               // Slot on screen, -1 while the text cache is drawn instead
+    uint64_t cueUseCounter_;
+
     // Rendering properties
     int windowWidth_, windowHeight_;
     static constexpr float FADE_DURATION_SECONDS = 2.0f;
@@ -115,13 +156,21 @@ private:
     )";
 
     // Helper methods
-    bool loadFont(const std::string& fontPath, int fontSize, FT_Face& face, std::map<GLchar, Character>& characters);
+    bool loadFont(const std::string& fontPath);
     GLuint compileShader(GLenum type, const char* source);
     GLuint createShaderProgram();
-    bool createFrameBuffer();
     void updateFade();
+    void relayout();
+    void layoutText(const std::string& text, TextSize size, TextFit& fit);
+    static float getBaseScale(TextSize size) { return (size == TextSize::BIG) ? 1.0f : 0.5f; }
     void updateTextCache();
+    void buildVertices(const std::string& text, TextSize size, const TextFit& fit, std::vector<GLfloat>& vertices) const;
     void renderCachedText();
+    void beginTextPass(float alpha);
+    void drawVertices(const std::vector<GLfloat>& vertices);
+    void endTextPass();
+    bool createCueTarget(StagedCue& slot);
+    void releaseCues();
     void renderText(const std::string& text, float x, float y, float scale, const std::map<GLchar, Character>& characters);
     float getTextWidth(const std::string& text, const std::map<GLchar, Character>& characters) const;
 };
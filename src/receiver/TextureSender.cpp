@@ -11,6 +11,9 @@ TextureSender::TextureSender()
     spoutSender_ = std::make_unique<SpoutSender>();
 #elif __APPLE__
     syphonSender_ = std::make_unique<SyphonSender>();
+#else
+    readback_ = std::make_unique<FrameReadback>();
+    shmServer_ = std::make_shared<ShmFrameServer>();
 #endif
 }
 
@@ -32,7 +35,17 @@ bool TextureSender::initialize(const std::string& senderName, int width, int hei
         return syphonSender_->initialize(senderName, width, height);
     }
 #else
-    std::cout << "Texture sharing not available on this platform" << std::endl;
+    std::cout << "Texture sharing not available on this platform - using PBO readback for " << senderName << std::endl;
+    if (readback_) {
+        if (!readback_->initialize(width, height)) {
+            return false;
+        }
+        // Shared memory is the default consumer; without it the readback only feeds added sinks
+        if (shmServer_ && shmServer_->initialize(senderName, width, height)) {
+            readback_->addSink(shmServer_);
+        }
+        return true;
+    }
     return true; // Allow app to run without texture sharing
 #endif
 
@@ -48,6 +61,14 @@ void TextureSender::shutdown() {
     if (syphonSender_) {
         syphonSender_->shutdown();
     }
+#else
+    // Stop the readback worker before unmapping the ring it writes into
+    if (readback_) {
+        readback_->shutdown();
+    }
+    if (shmServer_) {
+        shmServer_->shutdown();
+    }
 #endif
 }
 
@@ -61,7 +82,14 @@ bool TextureSender::sendTexture(unsigned int textureID, int width, int height) {
         return syphonSender_->sendTexture(textureID, width, height);
     }
 #else
-    // On platforms without texture sharing, just return success
+    // Read back only when someone is listening - otherwise just keep completed PBOs moving
+    if (readback_) {
+        if (readback_->hasSinks()) {
+            readback_->submit(textureID);
+        } else {
+            readback_->poll();
+        }
+    }
     return true;
 #endif
 
@@ -74,7 +102,7 @@ bool TextureSender::isInitialized() const {
 #elif __APPLE__
     return syphonSender_ && syphonSender_->isInitialized();
 #else
-    return true; // Always "initialized" on platforms without texture sharing
+    return readback_ && readback_->isInitialized();
 #endif
 }
 
@@ -103,8 +131,38 @@ std::string TextureSender::getPlatformInfo() const {
 #elif __APPLE__
     return "macOS Syphon";
 #else
-    return "No texture sharing";
+    if (shmServer_ && shmServer_->isInitialized()) {
+        return "Linux shared memory";
+    }
+    return "PBO readback";
+#endif
+}
+
+bool TextureSender::addFrameSink(std::shared_ptr<FrameSink> sink) {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    if (readback_) {
+        readback_->addSink(std::move(sink));
+        return true;
+    }
+#endif
+    return false;
+}
+
+bool TextureSender::hasReadback() const {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    return readback_ && readback_->isInitialized();
+#else
+    return false;
+#endif
+}
+
+ReadbackStats TextureSender::getReadbackStats() const {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    if (readback_) {
+        return readback_->getStats();
+    }
 #endif
+    return ReadbackStats();
 }
 
 } // namespace LiveText
\ No newline at end of file
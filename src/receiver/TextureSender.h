@@ -4,6 +4,8 @@
 
 #include "SpoutSender.h"
 #include "SyphonSender.h"
+#include "FrameReadback.h"
+#include "ShmFrameServer.h"
 
 namespace LiveText {
 
@@ -21,6 +23,12 @@ public:
     void setSize(int width, int height);
     std::string getPlatformInfo() const;
 
+    // CPU-side frame sinks fed by asynchronous PBO readback.
+    // Only available where there is no native texture sharing (Linux).
+    bool addFrameSink(std::shared_ptr<FrameSink> sink);
+    bool hasReadback() const;
+    ReadbackStats getReadbackStats() const;
+
 private:
     std::string senderName_;
     int width_, height_;
@@ -30,7 +38,10 @@ private:
 #elif __APPLE__
     std::unique_ptr<SyphonSender> syphonSender_;
 #else
-    // Linux/other platforms - no texture sharing
+    // Linux/other platforms - no texture sharing, frames leave through PBO readback
+    // and are published to a POSIX shared-memory ring (/dev/shm/<sender name>)
+    std::unique_ptr<FrameReadback> readback_;
+    std::shared_ptr<ShmFrameServer> shmServer_;
 #endif
 };
 
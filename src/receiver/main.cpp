@@ -1,27 +1,103 @@
 #include "ReceiverApp.h"
+#include "common/Logger.h"
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
-int main() {
+namespace {
+
+LiveText::ReceiverApp* g_app = nullptr;
+
+void handleSignal(int) {
+    if (g_app) {
+        g_app->requestStop();
+    }
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]" << std::endl;
+    std::cout << "  --headless     Offscreen rendering (EGL), no window or dashboard" << std::endl;
+    std::cout << "  --frames N     Render N frames, print timing and exit" << std::endl;
+    std::cout << "  --uncapped     Do not pace rendering to the output rate" << std::endl;
+    std::cout << "  --rate FPS     Output rate: 50, 59.94 or 60 (default 60)" << std::endl;
+    std::cout << "  --no-wake      Apply messages on the next output tick instead of rendering immediately" << std::endl;
+    std::cout << "  --preview-fps N    Dashboard preview refresh rate (default 15, 0 disables)" << std::endl;
+    std::cout << "  --preview-width N  Dashboard preview resolution (default 1280)" << std::endl;
+    std::cout << "  --timing-export F  Write per-pass CPU/GPU timestamps to CSV file F" << std::endl;
+    std::cout << "  --safe-area F      Fit text into this centered fraction of the output (default 0.9)" << std::endl;
+    std::cout << "  --state-file F     Keep the last shown text in F and restore it at startup" << std::endl;
+    std::cout << "                     (default livetext-receiver.state)" << std::endl;
+    std::cout << "  --no-state-file    Start blank and wait for the sender" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    LiveText::ReceiverConfig config;
+    config.launchTime = std::chrono::steady_clock::now();
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            config.headless = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            config.maxFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--uncapped") == 0) {
+            config.uncapped = true;
+        } else if (std::strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+            if (!LiveText::FrameRate::parse(argv[++i], config.outputRate)) {
+                std::cerr << "Invalid output rate: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--preview-fps") == 0 && i + 1 < argc) {
+            config.previewFps = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--preview-width") == 0 && i + 1 < argc) {
+            config.previewWidth = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--timing-export") == 0 && i + 1 < argc) {
+            config.timingExportPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--safe-area") == 0 && i + 1 < argc) {
+            config.safeArea = static_cast<float>(std::strtod(argv[++i], nullptr));
+        } else if (std::strcmp(argv[i], "--state-file") == 0 && i + 1 < argc) {
+            config.stateFilePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--no-state-file") == 0) {
+            config.stateFilePath.clear();
+        } else if (std::strcmp(argv[i], "--no-wake") == 0) {
+            config.wakePolicy = LiveText::WakePolicy::DEADLINE_ONLY;
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
     try {
-        LiveText::ReceiverApp app;
+        LiveText::ReceiverApp app(config);
 
         if (!app.initialize()) {
             std::cerr << "Failed to initialize receiver application" << std::endl;
             return 1;
         }
 
-        std::cout << "Live Text Receiver started successfully" << std::endl;
-        std::cout << "Controls:" << std::endl;
-        std::cout << "  ESC - Exit application" << std::endl;
-        std::cout << "  H   - Print health status" << std::endl;
-        std::cout << "  S   - Print subscriber statistics" << std::endl;
+        g_app = &app;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        std::cout << "Live Text Receiver started successfully" << (config.headless ? " (headless)" : "") << std::endl;
+        if (config.headless) {
+            std::cout << "Press Ctrl+C to exit" << std::endl;
+        } else {
+            std::cout << "Controls:" << std::endl;
+            std::cout << "  ESC - Exit application" << std::endl;
+            std::cout << "  H   - Print health status" << std::endl;
+            std::cout << "  S   - Print subscriber statistics" << std::endl;
+        }
         std::cout << std::endl;
         std::cout << "Spout sender name: LiveText" << std::endl;
         std::cout << "Waiting for text messages..." << std::endl;
 
         app.run();
+        g_app = nullptr;
         app.shutdown();
 
+        LiveText::Logger::instance().shutdown();
         std::cout << "Application shutdown complete" << std::endl;
         return 0;
 
@@ -29,4 +105,4 @@ int main() {
         std::cerr << "Application error: " << e.what() << std::endl;
         return 1;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,322 @@
+#include "AsyncPublisher.h"
+#include "common/ClockSync.h"
+#include "common/Logger.h"
+#include "common/TimerService.h"
+#include <algorithm>
+
+namespace LiveText {
+
+AsyncPublisher::AsyncPublisher(const std::string& primaryChannel, const std::string& secondaryChannel, int streamId,
+                               bool refreshWithText, int presentationDelayMs)
+    : publisher_(std::make_unique<DualAeronPublisher>(primaryChannel, secondaryChannel, streamId))
+    , running_(false)
+    , refreshWithText_(refreshWithText)
+    , presentationDelayUs_(static_cast<uint64_t>(std::max(presentationDelayMs, 0)) * 1000)
+    , refreshTimer_(0)
+    , refreshDue_(false)
+    , snapshotRequested_(false)
+    , pingsPending_(false)
+    , state_(TextMessage::createClearMessage())
+    , healthy_(false)
+    , sent_(0)
+    , retries_(0)
+    , failed_(0)
+    , refreshes_(0)
+    , stateRequests_(0)
+    , latencyMicros_(0)
+    , maxLatencyMicros_(0)
+    , enqueued_(0)
+    , revision_(0)
+    , rejected_(0)
+    , hasHeldBack_(false)
+    , maxDepth_(0)
+    , sentAtLastUpdate_(0)
+    , latencyMicrosAtLastUpdate_(0)
+    , lastStatsUpdate_(std::chrono::steady_clock::now())
+{
+}
+
+AsyncPublisher::~AsyncPublisher() {
+    shutdown();
+}
+
+bool AsyncPublisher::initialize() {
+    if (!publisher_->initialize()) {
+        return false;
+    }
+
+    refreshConnectionStats();
+    state_.stateHash = TextMessage::hashState(state_.getText(), state_.size);
+    running_ = true;
+    thread_ = std::thread(&AsyncPublisher::publishLoop, this);
+
+    // The timer thread only flags the refresh - the sockets stay with the publisher thread
+    refreshTimer_ = TimerService::instance().schedule(std::chrono::milliseconds(REFRESH_INTERVAL_MS), [this]() {
+        refreshDue_ = true;
+        wake();
+    });
+    return true;
+}
+
+void AsyncPublisher::shutdown() {
+    if (refreshTimer_ != 0) {
+        TimerService::instance().cancel(refreshTimer_);
+        refreshTimer_ = 0;
+    }
+
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            running_ = false;
+        }
+        wakeCondition_.notify_one();
+        thread_.join();
+    }
+
+    if (publisher_) {
+        publisher_->shutdown();
+    }
+    healthy_ = false;
+}
+
+bool AsyncPublisher::enqueue(const TextMessage& message) {
+    TextMessage stamped = message;
+    if (message.type == MessageType::TEXT_UPDATE || message.type == MessageType::CLEAR_TEXT) {
+        stamped.revision = ++revision_;
+        stamped.stateHash = TextMessage::hashState(stamped.text, stamped.textLength, stamped.size);
+    }
+
+    flush();
+    if (message.type == MessageType::CUE_PRELOAD) {
+        // Not state, so it must not displace held-back state - the UI sends preloads again
+        if (hasHeldBack_ || !push(stamped, TextMessage())) {
+            rejected_++;
+            return false;
+        }
+        return true;
+    }
+    return enqueueState(stamped, TextMessage());
+}
+
+bool AsyncPublisher::enqueueGo(uint32_t cueId, const std::string& text, TextSize size) {
+    TextMessage go = TextMessage::createCueGo(cueId, text, size);
+    go.revision = ++revision_;
+
+    // Refreshes and snapshots describe the cue as an ordinary text update
+    TextMessage cue(text, size);
+    cue.revision = go.revision;
+    cue.stateHash = go.stateHash;
+    cue.timestamp = go.timestamp;
+
+    flush();
+    return enqueueState(go, cue);
+}
+
+bool AsyncPublisher::enqueueState(const TextMessage& message, const TextMessage& cue) {
+    if (hasHeldBack_ || !push(message, cue)) {
+        if (!hasHeldBack_) {
+            LT_LOG_WARNING("Publish queue full - holding back the latest text until it drains");
+        }
+        rejected_++;
+        heldBack_ = message;
+        heldBackCue_ = cue;
+        hasHeldBack_ = true;
+        return false;
+    }
+    return true;
+}
+
+void AsyncPublisher::flush() {
+    if (hasHeldBack_ && push(heldBack_, heldBackCue_)) {
+        hasHeldBack_ = false;
+    }
+}
+
+bool AsyncPublisher::push(const TextMessage& message, const TextMessage& cue) {
+    if (!queue_.tryPush({message, cue, std::chrono::steady_clock::now()})) {
+        return false;
+    }
+
+    enqueued_++;
+    maxDepth_ = std::max(maxDepth_, queue_.size());
+    wake();
+    return true;
+}
+
+void AsyncPublisher::requestSnapshot() {
+    snapshotRequested_ = true;
+    wake();
+}
+
+void AsyncPublisher::answerPing(const TextMessage& ping) {
+    {
+        std::lock_guard<std::mutex> lock(pingMutex_);
+        if (pendingPings_.size() >= MAX_PENDING_PINGS) {
+            return;     // The receiver pings again
+        }
+        pendingPings_.push_back(ping);
+    }
+    pingsPending_ = true;
+    wake();
+}
+
+void AsyncPublisher::wake() {
+    // Only contended while the publisher thread is deciding to sleep - a few instructions
+    { std::lock_guard<std::mutex> lock(wakeMutex_); }
+    wakeCondition_.notify_one();
+}
+
+std::vector<ConnectionStats> AsyncPublisher::getConnectionStats() const {
+    std::lock_guard<std::mutex> lock(connectionStatsMutex_);
+    return connectionStats_;
+}
+
+void AsyncPublisher::updateStats() {
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - lastStatsUpdate_).count();
+
+    stats_.depth = queue_.size();
+    stats_.enqueued = enqueued_;
+    stats_.rejected = rejected_;
+    stats_.sent = sent_.load(std::memory_order_relaxed);
+    stats_.retries = retries_.load(std::memory_order_relaxed);
+    stats_.failed = failed_.load(std::memory_order_relaxed);
+    stats_.refreshes = refreshes_.load(std::memory_order_relaxed);
+    stats_.stateRequests = stateRequests_.load(std::memory_order_relaxed);
+    if (seconds < 1.0) {
+        return;
+    }
+
+    uint64_t latencyMicros = latencyMicros_.load(std::memory_order_relaxed);
+    uint64_t sentInWindow = stats_.sent - sentAtLastUpdate_;
+    stats_.avgLatencyMs = sentInWindow > 0
+        ? (latencyMicros - latencyMicrosAtLastUpdate_) / 1000.0 / sentInWindow : 0.0;
+    stats_.maxLatencyMs = maxLatencyMicros_.exchange(0, std::memory_order_relaxed) / 1000.0;
+    stats_.maxDepth = maxDepth_;
+
+    maxDepth_ = stats_.depth;
+    sentAtLastUpdate_ = stats_.sent;
+    latencyMicrosAtLastUpdate_ = latencyMicros;
+    lastStatsUpdate_ = now;
+}
+
+void AsyncPublisher::publishLoop() {
+    Logger::instance().setThreadName("publisher");
+
+    while (true) {
+        // Before anything queued - time spent waiting here widens the receiver's round trip
+        if (pingsPending_.exchange(false)) {
+            answerPings();
+        }
+
+        Entry* entry = queue_.front();
+        if (!entry) {
+            // Drained - only now is it safe to stop
+            if (!running_) {
+                break;
+            }
+
+            // A receiver asked - answer before the next periodic refresh
+            if (snapshotRequested_.exchange(false)) {
+                stateRequests_.fetch_add(1, std::memory_order_relaxed);
+                sendRefresh(true);
+                continue;
+            }
+            if (refreshDue_.exchange(false)) {
+                sendRefresh(refreshWithText_);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wakeCondition_.wait(lock, [this]() {
+                return !queue_.empty() || !running_ || refreshDue_ || snapshotRequested_ || pingsPending_;
+            });
+            continue;
+        }
+
+        // What the receivers should show from now on, whether or not this send gets through
+        if (entry->message.type == MessageType::TEXT_UPDATE || entry->message.type == MessageType::CLEAR_TEXT) {
+            if (entry->message.type == MessageType::CLEAR_TEXT && state_.type == MessageType::TEXT_UPDATE) {
+                fadingFrom_ = state_;
+                clearedAt_ = std::chrono::steady_clock::now();
+            }
+            state_ = entry->message;
+        } else if (entry->message.type == MessageType::CUE_GO) {
+            state_ = entry->cue;
+        }
+
+        // Shown this long after it leaves, on every receiver at once; retries keep the same time
+        if (presentationDelayUs_ > 0 && (entry->message.type == MessageType::TEXT_UPDATE ||
+                                         entry->message.type == MessageType::CLEAR_TEXT ||
+                                         entry->message.type == MessageType::CUE_GO)) {
+            entry->message.presentAt = ClockSync::now() + presentationDelayUs_;
+        }
+
+        // Retry only while this is still the newest state - otherwise the next entry replaces it
+        bool ok = publisher_->publish(entry->message);
+        for (int attempt = 0; !ok && attempt < MAX_RETRIES && running_ && queue_.size() == 1; ++attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(RETRY_INTERVAL_MS));
+            retries_.fetch_add(1, std::memory_order_relaxed);
+            ok = publisher_->publish(entry->message);
+        }
+
+        if (ok) {
+            uint64_t micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - entry->enqueuedAt).count());
+            latencyMicros_.fetch_add(micros, std::memory_order_relaxed);
+            uint64_t previousMax = maxLatencyMicros_.load(std::memory_order_relaxed);
+            while (micros > previousMax &&
+                   !maxLatencyMicros_.compare_exchange_weak(previousMax, micros, std::memory_order_relaxed)) {
+            }
+            sent_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            failed_.fetch_add(1, std::memory_order_relaxed);
+            LT_LOG_WARNING("Publish failed on both feeds (type %d)", entry->message.type);
+        }
+
+        queue_.pop();
+        refreshConnectionStats();
+    }
+}
+
+void AsyncPublisher::answerPings() {
+    {
+        std::lock_guard<std::mutex> lock(pingMutex_);
+        answeringPings_.swap(pendingPings_);
+    }
+
+    // Not retried - a lost pong is just a missing sample
+    for (const TextMessage& ping : answeringPings_) {
+        publisher_->publish(TextMessage::createClockPong(ping, ClockSync::now()));
+    }
+    answeringPings_.clear();
+}
+
+void AsyncPublisher::sendRefresh(bool withText) {
+    TextMessage refresh = TextMessage::createStateRefresh(state_, withText);
+
+    // Cleared moments ago - a joining receiver picks the fade-out up where it is
+    auto sinceClear = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - clearedAt_);
+    if (withText && state_.type == MessageType::CLEAR_TEXT && fadingFrom_.textLength > 0 &&
+        sinceClear.count() < FADE_OUT_MS) {
+        refresh.setText(fadingFrom_.getText());
+        refresh.size = fadingFrom_.size;
+        refresh.stateFlags |= STATE_FADING;
+        refresh.fadeElapsedMs = static_cast<uint16_t>(sinceClear.count());
+    }
+
+    // Not retried - another one follows in REFRESH_INTERVAL_MS
+    publisher_->publish(refresh);
+    refreshes_.fetch_add(1, std::memory_order_relaxed);
+    refreshConnectionStats();
+}
+
+void AsyncPublisher::refreshConnectionStats() {
+    std::vector<ConnectionStats> stats = publisher_->getStats();
+    healthy_.store(publisher_->isHealthy(), std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(connectionStatsMutex_);
+    connectionStats_.swap(stats);
+}
+
+} // namespace LiveText
@@ -0,0 +1,169 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/AeronConnection.h"
+#include "common/SpscQueue.h"
+#include "common/TextMessage.h"
+
+namespace LiveText {
+
+struct PublishQueueStats {
+    size_t depth = 0;           // Waiting to be sent right now
+    size_t maxDepth = 0;        // Deepest seen at enqueue, over the last window
+    uint64_t enqueued = 0;
+    uint64_t sent = 0;          // Reached at least one feed
+    uint64_t retries = 0;
+    uint64_t failed = 0;        // Given up on, or superseded by a newer message while retrying
+    uint64_t rejected = 0;      // Queue full at enqueue - held back, then replaced by newer state
+    uint64_t refreshes = 0;     // Periodic STATE_REFRESH messages
+    uint64_t stateRequests = 0; // Snapshots sent to joining or out-of-step receivers
+    double avgLatencyMs = 0.0;  // Enqueue to sendto() returning, over the last window
+    double maxLatencyMs = 0.0;
+};
+
+// Publishes text from the UI thread without touching the network on it.
+//
+// enqueue() stamps text updates and clears with the next revision and the
+// hash of the state they leave, copies the message into a lock-free SPSC
+// queue and returns. A dedicated thread owns the DualAeronPublisher and its
+// sockets: it sends queued messages in order, retries a failed send a few
+// times unless newer state is already waiting (every message carries the
+// full text, so the newer one makes the retry pointless), and every
+// REFRESH_INTERVAL_MS - paced by the shared TimerService - sends a
+// STATE_REFRESH with the current revision, size and hash so a receiver that
+// missed an update, or restarted, can notice and repair itself.
+//
+// A CUE_GO carries no text on the wire: enqueueGo() queues the cue's text
+// and size beside it, and the thread takes the state refreshes describe from
+// those, whether or not the receivers ever got the preload.
+//
+// The thread also answers receivers' CLOCK_PINGs, ahead of anything queued,
+// and stamps text updates, clears and GOs with a presentation time - its
+// clock plus presentationDelayMs as it sends them - so receivers that know
+// the offset to that clock all put the change up on the same output frame.
+class AsyncPublisher {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 64;
+    static constexpr int REFRESH_INTERVAL_MS = 1000;
+    static constexpr int RETRY_INTERVAL_MS = 10;
+    static constexpr int MAX_RETRIES = 5;
+    static constexpr int FADE_OUT_MS = 2000;    // Receiver's fade after a clear - snapshots carry it
+    static constexpr size_t MAX_PENDING_PINGS = 64;
+
+    // refreshWithText: every refresh carries the text, so receivers repair
+    // without asking; otherwise they send a STATE_REQUEST on a mismatch.
+    // presentationDelayMs: 0 sends updates to be shown on arrival.
+    AsyncPublisher(const std::string& primaryChannel, const std::string& secondaryChannel, int streamId,
+                   bool refreshWithText = false, int presentationDelayMs = 0);
+    ~AsyncPublisher();
+
+    // Opens the feeds on the calling thread, then hands them to the publisher thread
+    bool initialize();
+
+    // Sends what is still queued, then stops the thread and closes the feeds
+    void shutdown();
+
+    // UI thread: never blocks. If the queue is full the message is held back
+    // (replacing any older held-back one - each carries the full text) and
+    // false is returned; flush() or the next enqueue() queues it once there is room.
+    // A CUE_PRELOAD that does not fit is dropped instead.
+    bool enqueue(const TextMessage& message);
+
+    // UI thread: GO for a preloaded cue, held back like a text update when the queue is full.
+    // Only the id and the hash go out; the text and size stay in the queue for the refreshes.
+    bool enqueueGo(uint32_t cueId, const std::string& text, TextSize size);
+    void flush();
+    bool hasHeldBack() const { return hasHeldBack_; }
+
+    // Any thread: a receiver is joining or out of step - send a snapshot (the text, and
+    // the fade-out if a clear is still fading) now rather than at the next refresh
+    void requestSnapshot();
+
+    // Any thread: a receiver's CLOCK_PING - the pong is stamped as it goes out
+    void answerPing(const TextMessage& ping);
+
+    // UI thread: revision of the last text update or clear enqueued
+    uint32_t getRevision() const { return revision_; }
+
+    // Snapshots taken by the publisher thread after each send
+    std::vector<ConnectionStats> getConnectionStats() const;
+    bool isHealthy() const { return healthy_.load(std::memory_order_relaxed); }
+
+    // UI thread: refresh the windowed values, at most once a second
+    void updateStats();
+    const PublishQueueStats& getStats() const { return stats_; }
+
+private:
+    struct Entry {
+        TextMessage message;
+        TextMessage cue;        // CUE_GO: the state it leaves, as a text update - never sent
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    std::unique_ptr<DualAeronPublisher> publisher_;   // Publisher thread only once started
+    SpscQueue<Entry, QUEUE_CAPACITY> queue_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    bool refreshWithText_;
+    uint64_t presentationDelayUs_;
+    int refreshTimer_;      // TimerService id, 0 if none
+
+    // Wakes the publisher thread when something is queued or a refresh is due
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<bool> refreshDue_;
+    std::atomic<bool> snapshotRequested_;
+
+    // Pings waiting for a pong, from the feedback subscriber's thread
+    std::mutex pingMutex_;
+    std::vector<TextMessage> pendingPings_;
+    std::vector<TextMessage> answeringPings_;   // Publisher thread only
+    std::atomic<bool> pingsPending_;
+
+    // Publisher thread only: the last text update or clear, as the receivers should show it,
+    // and the text a clear is fading out
+    TextMessage state_;
+    TextMessage fadingFrom_;
+    std::chrono::steady_clock::time_point clearedAt_;
+
+    // Published by the publisher thread
+    mutable std::mutex connectionStatsMutex_;
+    std::vector<ConnectionStats> connectionStats_;
+    std::atomic<bool> healthy_;
+    std::atomic<uint64_t> sent_;
+    std::atomic<uint64_t> retries_;
+    std::atomic<uint64_t> failed_;
+    std::atomic<uint64_t> refreshes_;
+    std::atomic<uint64_t> stateRequests_;
+    std::atomic<uint64_t> latencyMicros_;       // Running total
+    std::atomic<uint64_t> maxLatencyMicros_;    // Since the UI last read it
+
+    // UI thread only
+    uint64_t enqueued_;
+    uint32_t revision_;
+    uint64_t rejected_;
+    TextMessage heldBack_;
+    TextMessage heldBackCue_;
+    bool hasHeldBack_;
+    size_t maxDepth_;
+    PublishQueueStats stats_;
+    uint64_t sentAtLastUpdate_;
+    uint64_t latencyMicrosAtLastUpdate_;
+    std::chrono::steady_clock::time_point lastStatsUpdate_;
+
+    bool push(const TextMessage& message, const TextMessage& cue);
+    bool enqueueState(const TextMessage& message, const TextMessage& cue);
+    void wake();
+    void publishLoop();
+    void answerPings();
+    void sendRefresh(bool withText);
+    void refreshConnectionStats();
+};
+
+} // namespace LiveText
@@ -0,0 +1,136 @@
+#include "CueList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace LiveText {
+
+namespace {
+
+bool isBlank(const char* line, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        if (line[i] != ' ' && line[i] != '\t') {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isDirective(const char* line, size_t length, const char* directive) {
+    return length == strlen(directive) && memcmp(line, directive, length) == 0;
+}
+
+} // namespace
+
+bool CueList::load(const std::string& path, TextSize defaultSize) {
+    auto start = std::chrono::steady_clock::now();
+    close();
+
+    if (!file_.openRead(path)) {
+        std::cerr << "Failed to open show file " << path << std::endl;
+        return false;
+    }
+    if (file_.size() > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "Show file " << path << " is too large" << std::endl;
+        file_.close();
+        return false;
+    }
+
+    // One pass over the mapping, line by line, recording where each cue starts and ends
+    const char* data = reinterpret_cast<const char*>(file_.data());
+    size_t fileSize = file_.size();
+    size_t pos = 0;
+    size_t cueEnd = 0;
+    size_t tooLong = 0;
+    bool inCue = false;
+    Cue cue = {0, 0, defaultSize};
+
+    auto finishCue = [&]() {
+        cue.length = static_cast<uint32_t>(cueEnd - cue.offset);
+        if (cue.length > MAX_CUE_LENGTH) {
+            tooLong++;
+        }
+        cues_.push_back(cue);
+        cue = {0, 0, defaultSize};
+        inCue = false;
+    };
+
+    while (pos < fileSize) {
+        const char* newline = static_cast<const char*>(memchr(data + pos, '\n', fileSize - pos));
+        size_t lineEnd = newline ? static_cast<size_t>(newline - data) : fileSize;
+        size_t next = newline ? lineEnd + 1 : fileSize;
+        if (lineEnd > pos && data[lineEnd - 1] == '\r') {
+            lineEnd--;
+        }
+
+        const char* line = data + pos;
+        size_t length = lineEnd - pos;
+        if (isBlank(line, length)) {
+            if (inCue) {
+                finishCue();
+            } else {
+                cue.size = defaultSize;     // A directive only applies to the cue right below it
+            }
+        } else if (!inCue && line[0] == '#') {
+            // Comment
+        } else if (!inCue && isDirective(line, length, "@big")) {
+            cue.size = TextSize::BIG;
+        } else if (!inCue && isDirective(line, length, "@small")) {
+            cue.size = TextSize::SMALL;
+        } else {
+            if (!inCue) {
+                cue.offset = static_cast<uint32_t>(pos);
+                inCue = true;
+            }
+            cueEnd = lineEnd;
+        }
+        pos = next;
+    }
+    if (inCue) {
+        finishCue();
+    }
+
+    loadMs_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Loaded show file " << path << ": " << cues_.size() << " cues in " << loadMs_ << " ms" << std::endl;
+    if (tooLong > 0) {
+        std::cerr << tooLong << " cues are longer than " << MAX_CUE_LENGTH
+                  << " characters and will be cut short" << std::endl;
+    }
+    return true;
+}
+
+void CueList::close() {
+    file_.close();
+    cues_.clear();
+    loadMs_ = 0.0;
+}
+
+std::string CueList::text(size_t index) const {
+    const Cue& cue = cues_[index];
+    const char* data = reinterpret_cast<const char*>(file_.data()) + cue.offset;
+
+    std::string result;
+    result.reserve(std::min<size_t>(cue.length, MAX_CUE_LENGTH));
+    for (uint32_t i = 0; i < cue.length && result.size() < MAX_CUE_LENGTH; ++i) {
+        if (data[i] != '\r') {
+            result.push_back(data[i]);
+        }
+    }
+    return result;
+}
+
+const char* CueList::firstLine(size_t index, size_t& length) const {
+    const Cue& cue = cues_[index];
+    const char* line = reinterpret_cast<const char*>(file_.data()) + cue.offset;
+    const char* newline = static_cast<const char*>(memchr(line, '\n', cue.length));
+
+    length = newline ? static_cast<size_t>(newline - line) : cue.length;
+    if (length > 0 && line[length - 1] == '\r') {
+        length--;
+    }
+    return line;
+}
+
+} // namespace LiveText
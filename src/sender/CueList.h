@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/MappedFile.h"
+#include "common/TextMessage.h"
+
+namespace LiveText {
+
+// A show file's cues, in running order.
+//
+// The file is plain text: cues are separated by blank lines, a cue's lines
+// are sent as they are ('\n' breaks on the receiver), a "@big" or "@small"
+// line at the top of a cue sets its size and "#" lines at the top of a cue
+// are comments. The file is memory-mapped and only indexed - each cue is an
+// offset and a length into the mapping - so a show of thousands of cues
+// opens in milliseconds and costs no more memory than its index; text is
+// copied out only for the few cues being previewed or sent.
+class CueList {
+public:
+    static constexpr size_t MAX_CUE_LENGTH = sizeof(TextMessage::text) - 1;
+
+    bool load(const std::string& path, TextSize defaultSize = TextSize::SMALL);
+    void close();
+
+    bool isLoaded() const { return file_.isOpen(); }
+    const std::string& path() const { return file_.path(); }
+    size_t size() const { return cues_.size(); }
+    double getLoadMs() const { return loadMs_; }
+
+    // Cue ids go on the wire; index 0 is cue 1, so 0 never names a cue
+    static uint32_t cueId(size_t index) { return static_cast<uint32_t>(index + 1); }
+
+    // Text as sent: carriage returns dropped, capped at MAX_CUE_LENGTH
+    std::string text(size_t index) const;
+    TextSize textSize(size_t index) const { return cues_[index].size; }
+
+    // First line, for a list row - points into the mapping, no copy
+    const char* firstLine(size_t index, size_t& length) const;
+
+private:
+    struct Cue {
+        uint32_t offset;
+        uint32_t length;
+        TextSize size;
+    };
+
+    MappedFile file_;
+    std::vector<Cue> cues_;
+    double loadMs_ = 0.0;
+};
+
+} // namespace LiveText
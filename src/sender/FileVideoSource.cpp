@@ -0,0 +1,67 @@
+#include "FileVideoSource.h"
+#include <iostream>
+
+namespace LiveText {
+
+FileVideoSource::FileVideoSource(const std::string& path, int width, int height, double fps, VideoPixelFormat format)
+    : path_(path)
+    , width_(width)
+    , height_(height)
+    , fps_(fps)
+    , format_(format)
+    , frameBytes_(0)
+    , frameCount_(0)
+    , frameIndex_(0)
+{
+}
+
+FileVideoSource::~FileVideoSource() {
+    stop();
+}
+
+bool FileVideoSource::start() {
+    if (width_ <= 0 || height_ <= 0 || (format_ == VideoPixelFormat::UYVY && (width_ & 1))) {
+        std::cerr << "Invalid video file frame size: " << width_ << "x" << height_ << std::endl;
+        return false;
+    }
+
+    if (!file_.openRead(path_)) {
+        std::cerr << "Failed to open video file: " << path_ << std::endl;
+        return false;
+    }
+
+    frameBytes_ = static_cast<size_t>(width_) * height_ * bytesPerPixel(format_);
+    frameCount_ = file_.size() / frameBytes_;
+    if (frameCount_ == 0) {
+        std::cerr << "Video file " << path_ << " is smaller than one " << width_ << "x" << height_ << " frame" << std::endl;
+        file_.close();
+        return false;
+    }
+    if (file_.size() % frameBytes_ != 0) {
+        std::cerr << "Warning: " << path_ << " has " << (file_.size() % frameBytes_)
+                  << " trailing bytes - check the frame size and format" << std::endl;
+    }
+
+    frameIndex_ = 0;
+    startCapture("video-file");
+    std::cout << "Video file source: " << path_ << " (" << frameCount_ << " frames of "
+              << width_ << "x" << height_ << (format_ == VideoPixelFormat::UYVY ? " UYVY" : " BGRA") << ")" << std::endl;
+    return true;
+}
+
+void FileVideoSource::stop() {
+    stopCapture();
+    file_.close();
+}
+
+void FileVideoSource::captureNext() {
+    if (!waitForNextFrame(fps_)) {
+        return;
+    }
+
+    const uint8_t* frame = file_.data() + frameIndex_ * frameBytes_;
+    deliverFrame(frame, width_, height_, width_ * bytesPerPixel(format_), format_, frameIndex_);
+    frameIndex_ = (frameIndex_ + 1) % frameCount_;
+}
+
+} // namespace LiveText
@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+#include "common/MappedFile.h"
+#include "VideoSource.h"
+
+namespace LiveText {
+
+// Raw BGRA or UYVY frames read from a memory-mapped file, looped.
+//
+// The file is headerless: frames of width * height * bytes-per-pixel, back to
+// back (as written by e.g. ffmpeg -f rawvideo -pix_fmt bgra|uyvy422). Frames
+// are handed to the capture path straight from the mapping, so after the
+// first pass through the file (page cache warm) the source adds no I/O and a
+// run is reproducible from one machine to the next.
+class FileVideoSource : public VideoSource {
+public:
+    FileVideoSource(const std::string& path, int width, int height, double fps, VideoPixelFormat format);
+    ~FileVideoSource() override;
+
+    bool start() override;
+    void stop() override;
+    bool isActive() const override { return isCapturing(); }
+    const char* getKind() const override { return "File"; }
+    std::string getName() const override { return path_; }
+
+private:
+    std::string path_;
+    int width_, height_;
+    double fps_;
+    VideoPixelFormat format_;
+    MappedFile file_;
+    size_t frameBytes_;
+    size_t frameCount_;
+    size_t frameIndex_;
+
+    void captureNext() override;
+};
+
+} // namespace LiveText
@@ -0,0 +1,269 @@
+#include "FrameDownscaler.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LT_DOWNSCALE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LT_TARGET_AVX2
+#else
+#define LT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#define LT_DOWNSCALE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace LiveText {
+
+namespace {
+
+// Both kernels work in 4-byte units: one BGRA pixel or one UYVY macropixel (two pixels)
+typedef void (*HalveRowFn)(const uint8_t* row0, const uint8_t* row1, uint8_t* out, int outUnits, bool uyvy);
+
+inline uint8_t average(uint8_t a, uint8_t b) {
+    return static_cast<uint8_t>((a + b + 1) >> 1);
+}
+
+void halveRowScalar(const uint8_t* row0, const uint8_t* row1, uint8_t* out, int outUnits, bool uyvy) {
+    for (int i = 0; i < outUnits; ++i) {
+        const uint8_t* a = row0 + i * 8;
+        const uint8_t* b = row1 + i * 8;
+        uint8_t even[4], odd[4];
+        for (int k = 0; k < 4; ++k) {
+            even[k] = average(a[k], b[k]);
+            odd[k] = average(a[k + 4], b[k + 4]);
+        }
+
+        uint8_t* o = out + i * 4;
+        if (uyvy) {
+            o[0] = average(even[0], odd[0]);    // U
+            o[1] = average(even[1], even[3]);   // Y0 - the first macropixel's two lumas
+            o[2] = average(even[2], odd[2]);    // V
+            o[3] = average(odd[1], odd[3]);     // Y1 - the second's
+        } else {
+            for (int k = 0; k < 4; ++k) {
+                o[k] = average(even[k], odd[k]);
+            }
+        }
+    }
+}
+
+#ifdef LT_DOWNSCALE_X86
+LT_TARGET_AVX2
+void halveRowAVX2(const uint8_t* row0, const uint8_t* row1, uint8_t* out, int outUnits, bool uyvy) {
+    const __m256i chromaMask = _mm256_set1_epi32(0x00FF00FF);
+    const __m256i lumaLowMask = _mm256_set1_epi32(0x0000FF00);
+    const __m256i lumaHighMask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+    int i = 0;
+    for (; i + 8 <= outUnits; i += 8) {
+        __m256i v0 = _mm256_avg_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + i * 8)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + i * 8)));
+        __m256i v1 = _mm256_avg_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + i * 8 + 32)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + i * 8 + 32)));
+
+        // Split into even and odd units; the 128-bit lanes come out interleaved and are put back below
+        __m256i even = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1),
+                                                             _MM_SHUFFLE(2, 0, 2, 0)));
+        __m256i odd = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(v0), _mm256_castsi256_ps(v1),
+                                                            _MM_SHUFFLE(3, 1, 3, 1)));
+
+        __m256i result = _mm256_avg_epu8(even, odd);
+        if (uyvy) {
+            __m256i lumaEven = _mm256_avg_epu8(even, _mm256_srli_epi32(even, 16));
+            __m256i lumaOdd = _mm256_avg_epu8(odd, _mm256_srli_epi32(odd, 16));
+            result = _mm256_or_si256(_mm256_and_si256(result, chromaMask),
+                     _mm256_or_si256(_mm256_and_si256(lumaEven, lumaLowMask),
+                                     _mm256_and_si256(_mm256_slli_epi32(lumaOdd, 16), lumaHighMask)));
+        }
+
+        result = _mm256_permute4x64_epi64(result, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), result);
+    }
+
+    halveRowScalar(row0 + i * 8, row1 + i * 8, out + i * 4, outUnits - i, uyvy);
+}
+
+bool cpuHasAVX2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+#ifdef LT_DOWNSCALE_NEON
+void halveRowNEON(const uint8_t* row0, const uint8_t* row1, uint8_t* out, int outUnits, bool uyvy) {
+    const uint32x4_t chromaMask = vdupq_n_u32(0x00FF00FF);
+    const uint32x4_t lumaLowMask = vdupq_n_u32(0x0000FF00);
+    const uint32x4_t lumaHighMask = vdupq_n_u32(0xFF000000);
+
+    int i = 0;
+    for (; i + 4 <= outUnits; i += 4) {
+        // De-interleaving loads split even and odd units directly
+        uint32x4x2_t a = vld2q_u32(reinterpret_cast<const uint32_t*>(row0 + i * 8));
+        uint32x4x2_t b = vld2q_u32(reinterpret_cast<const uint32_t*>(row1 + i * 8));
+        uint8x16_t even = vrhaddq_u8(vreinterpretq_u8_u32(a.val[0]), vreinterpretq_u8_u32(b.val[0]));
+        uint8x16_t odd = vrhaddq_u8(vreinterpretq_u8_u32(a.val[1]), vreinterpretq_u8_u32(b.val[1]));
+
+        uint8x16_t result = vrhaddq_u8(even, odd);
+        if (uyvy) {
+            uint32x4_t lumaEven = vreinterpretq_u32_u8(
+                vrhaddq_u8(even, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(even), 16))));
+            uint32x4_t lumaOdd = vreinterpretq_u32_u8(
+                vrhaddq_u8(odd, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(odd), 16))));
+            uint32x4_t merged = vorrq_u32(vandq_u32(vreinterpretq_u32_u8(result), chromaMask),
+                                vorrq_u32(vandq_u32(lumaEven, lumaLowMask),
+                                          vandq_u32(vshlq_n_u32(lumaOdd, 16), lumaHighMask)));
+            result = vreinterpretq_u8_u32(merged);
+        }
+        vst1q_u8(out + i * 4, result);
+    }
+
+    halveRowScalar(row0 + i * 8, row1 + i * 8, out + i * 4, outUnits - i, uyvy);
+}
+#endif
+
+HalveRowFn rowFunction(DownscaleKernel kernel) {
+    switch (kernel) {
+#ifdef LT_DOWNSCALE_X86
+        case DownscaleKernel::AVX2:
+            return halveRowAVX2;
+#endif
+#ifdef LT_DOWNSCALE_NEON
+        case DownscaleKernel::NEON:
+            return halveRowNEON;
+#endif
+        default:
+            return halveRowScalar;
+    }
+}
+
+} // namespace
+
+bool FrameDownscaler::isSupported(DownscaleKernel kernel) {
+    switch (kernel) {
+        case DownscaleKernel::SCALAR:
+            return true;
+        case DownscaleKernel::AVX2:
+#ifdef LT_DOWNSCALE_X86
+        {
+            static const bool supported = cpuHasAVX2();
+            return supported;
+        }
+#else
+            return false;
+#endif
+        case DownscaleKernel::NEON:
+#ifdef LT_DOWNSCALE_NEON
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+DownscaleKernel FrameDownscaler::bestKernel() {
+    if (isSupported(DownscaleKernel::AVX2)) {
+        return DownscaleKernel::AVX2;
+    }
+    if (isSupported(DownscaleKernel::NEON)) {
+        return DownscaleKernel::NEON;
+    }
+    return DownscaleKernel::SCALAR;
+}
+
+const char* FrameDownscaler::kernelName(DownscaleKernel kernel) {
+    switch (kernel) {
+        case DownscaleKernel::AVX2: return "AVX2";
+        case DownscaleKernel::NEON: return "NEON";
+        default: return "scalar";
+    }
+}
+
+int FrameDownscaler::chooseFactor(int width, int height, int targetWidth, int targetHeight) {
+    if (width <= 0 || height <= 0 || targetWidth <= 0 || targetHeight <= 0) {
+        return 1;
+    }
+
+    // Aspect-fit, as the background is drawn; the frame is shown at 1/shrink of its size
+    double shrink = std::max(static_cast<double>(width) / targetWidth, static_cast<double>(height) / targetHeight);
+    int factor = 1;
+    while (factor * 2 <= MAX_FACTOR && factor * 2 <= shrink) {
+        factor *= 2;
+    }
+    return factor;
+}
+
+void FrameDownscaler::halve(const uint8_t* src, int width, int height, int srcStride, VideoPixelFormat format,
+                            uint8_t* dst, int dstStride, DownscaleKernel kernel) {
+    HalveRowFn halveRow = rowFunction(isSupported(kernel) ? kernel : DownscaleKernel::SCALAR);
+    bool uyvy = format == VideoPixelFormat::UYVY;
+    int outUnits = (width * bytesPerPixel(format) / 4) / 2;
+
+    for (int y = 0; y < height / 2; ++y) {
+        const uint8_t* row0 = src + static_cast<size_t>(2 * y) * srcStride;
+        halveRow(row0, row0 + srcStride, dst + static_cast<size_t>(y) * dstStride, outUnits, uyvy);
+    }
+}
+
+void FrameDownscaler::downscale(const uint8_t* src, int width, int height, int srcStride, VideoPixelFormat format,
+                                int factor, DownscaleKernel kernel,
+                                std::vector<uint8_t>& dst, std::vector<uint8_t>& scratch,
+                                int& outWidth, int& outHeight) {
+    const int bpp = bytesPerPixel(format);
+    const int pairPixels = 8 / bpp;     // Pixels in two 4-byte units - the halving step
+
+    if (factor <= 1) {
+        size_t rowBytes = static_cast<size_t>(width) * bpp;
+        dst.resize(rowBytes * height);
+        if (static_cast<size_t>(srcStride) == rowBytes) {
+            memcpy(dst.data(), src, rowBytes * height);
+        } else {
+            for (int row = 0; row < height; ++row) {
+                memcpy(dst.data() + row * rowBytes, src + static_cast<size_t>(row) * srcStride, rowBytes);
+            }
+        }
+        outWidth = width;
+        outHeight = height;
+        return;
+    }
+
+    const uint8_t* current = src;
+    int currentWidth = width;
+    int currentHeight = height;
+    int currentStride = srcStride;
+
+    for (int remaining = factor; remaining > 1; remaining /= 2) {
+        int nextWidth = (currentWidth / pairPixels) * pairPixels / 2;
+        int nextHeight = currentHeight / 2;
+        int nextStride = nextWidth * bpp;
+        std::vector<uint8_t>& target = (remaining == 2) ? dst : scratch;
+        target.resize(static_cast<size_t>(nextStride) * nextHeight);
+
+        halve(current, currentWidth, currentHeight, currentStride, format, target.data(), nextStride, kernel);
+
+        current = target.data();
+        currentWidth = nextWidth;
+        currentHeight = nextHeight;
+        currentStride = nextStride;
+    }
+
+    outWidth = currentWidth;
+    outHeight = currentHeight;
+}
+
+} // namespace LiveText
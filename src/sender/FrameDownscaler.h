@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "VideoFrame.h"
+
+namespace LiveText {
+
+enum class DownscaleKernel {
+    SCALAR,
+    AVX2,
+    NEON
+};
+
+// 2x2 box downscaling of BGRA or UYVY frames by halving, applied once or twice
+// for a 4x or 16x smaller image.
+//
+// Every kernel averages the two rows first, then the two columns, each with
+// the round-half-up average (a + b + 1) >> 1 that _mm256_avg_epu8 and
+// vrhaddq_u8 compute, so the SIMD kernels are bit-exact with the scalar one.
+// UYVY is halved per 4-byte macropixel pair: chroma of the two macropixels is
+// averaged, and each output luma is the mean of one input macropixel's two.
+class FrameDownscaler {
+public:
+    static constexpr int MAX_FACTOR = 4;    // Per axis - uploads shrink by up to 16x
+
+    // Fastest kernel this CPU supports (AVX2 is detected at run time)
+    static DownscaleKernel bestKernel();
+    static bool isSupported(DownscaleKernel kernel);
+    static const char* kernelName(DownscaleKernel kernel);
+
+    // Largest power-of-two factor (up to MAX_FACTOR) that still leaves at least
+    // as many pixels as the frame covers when aspect-fitted into the target
+    static int chooseFactor(int width, int height, int targetWidth, int targetHeight);
+
+    // Halve width and height (width rounded down to whole BGRA pixel pairs or
+    // UYVY macropixel pairs). dst holds height / 2 rows of dstStride bytes.
+    // Falls back to scalar if the kernel isn't supported.
+    static void halve(const uint8_t* src, int width, int height, int srcStride, VideoPixelFormat format,
+                      uint8_t* dst, int dstStride, DownscaleKernel kernel);
+
+    // Downscale by factor (1, 2 or 4) into dst, resized to tightly packed rows.
+    // scratch holds the intermediate image for factor 4. The result size goes to outWidth/outHeight.
+    static void downscale(const uint8_t* src, int width, int height, int srcStride, VideoPixelFormat format,
+                          int factor, DownscaleKernel kernel,
+                          std::vector<uint8_t>& dst, std::vector<uint8_t>& scratch,
+                          int& outWidth, int& outHeight);
+};
+
+} // namespace LiveText
@@ -1,4 +1,5 @@
 #include "NDIReceiver.h"
+#include "common/Logger.h"
 #include <iostream>
 #include <cstring>
 
@@ -8,20 +9,40 @@
 
 namespace LiveText {
 
-NDIReceiver::NDIReceiver()
+NDIReceiver::NDIReceiver(const std::string& sourceName)
     : ndiFind_(nullptr)
     , ndiRecv_(nullptr)
     , initialized_(false)
     , connected_(false)
-    , currentSourceName_("")
+    , preferUYVY_(false)
+    , discovering_(false)
+    , requestedSourceName_(sourceName)
+    , reconnectRequested_(false)
+    , lastFrameTime_(std::chrono::steady_clock::now())
 {
-    memset(&currentFrame_, 0, sizeof(currentFrame_));
 }
 
 NDIReceiver::~NDIReceiver() {
     shutdown();
 }
 
+bool NDIReceiver::start() {
+    std::string sourceName;
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        sourceName = requestedSourceName_;
+    }
+    return initialize() && connect(sourceName);
+}
+
+std::string NDIReceiver::getName() const {
+    std::lock_guard<std::mutex> lock(sourcesMutex_);
+    if (!currentSourceName_.empty()) {
+        return currentSourceName_;
+    }
+    return "searching for " + (requestedSourceName_.empty() ? std::string("any source") : requestedSourceName_);
+}
+
 bool NDIReceiver::initialize() {
 #ifdef ENABLE_NDI
     if (initialized_) {
@@ -48,7 +69,10 @@ bool NDIReceiver::initialize() {
     }
 
     initialized_ = true;
-    std::cout << "NDI initialized successfully" << std::endl;
+    discovering_ = true;
+    discoveryThread_ = std::thread(&NDIReceiver::discoveryLoop, this);
+
+    std::cout << "NDI initialized successfully, discovering sources in the background" << std::endl;
     return true;
 #else
     std::cerr << "NDI support not compiled in. Build with -DENABLE_NDI=ON" << std::endl;
@@ -57,175 +81,207 @@ bool NDIReceiver::initialize() {
 }
 
 bool NDIReceiver::connect(const std::string& sourceName) {
-#ifdef ENABLE_NDI
     if (!initialized_) {
         std::cerr << "NDI not initialized" << std::endl;
         return false;
     }
 
-    if (connected_) {
-        disconnect();
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        requestedSourceName_ = sourceName;
     }
 
-    // Wait a bit for sources to be discovered
-    std::cout << "Searching for NDI sources..." << std::endl;
-    NDIlib_find_wait_for_sources(ndiFind_, 2000);
-
-    // Get available sources
-    uint32_t numSources = 0;
-    const NDIlib_source_t* sources = NDIlib_find_get_current_sources(ndiFind_, &numSources);
-
-    if (numSources == 0) {
-        std::cerr << "No NDI sources found" << std::endl;
-        return false;
+    // The capture thread drops the current source (if any) and picks up the new one
+    reconnectRequested_ = true;
+    if (!isCapturing()) {
+        startCapture("ndi");
     }
+    return true;
+}
 
-    std::cout << "Found " << numSources << " NDI source(s):" << std::endl;
-    for (uint32_t i = 0; i < numSources; i++) {
-        std::cout << "  [" << i << "] " << sources[i].p_ndi_name << std::endl;
+std::vector<std::string> NDIReceiver::getAvailableSources() const {
+    std::lock_guard<std::mutex> lock(sourcesMutex_);
+    std::vector<std::string> sourceNames;
+    sourceNames.reserve(sources_.size());
+    for (const DiscoveredSource& source : sources_) {
+        sourceNames.push_back(source.name);
     }
+    return sourceNames;
+}
+
+std::string NDIReceiver::getSourceName() const {
+    std::lock_guard<std::mutex> lock(sourcesMutex_);
+    return currentSourceName_;
+}
 
-    // Select source
-    int selectedIndex = -1;
-    if (sourceName.empty()) {
-        // Use first source
-        selectedIndex = 0;
-    } else {
-        // Find source by name
+void NDIReceiver::discoveryLoop() {
+#ifdef ENABLE_NDI
+    Logger::instance().setThreadName("ndi-discovery");
+
+    bool first = true;
+    while (discovering_) {
+        // Returns early when the list changes, so new sources show up within a round trip
+        bool changed = NDIlib_find_wait_for_sources(ndiFind_, DISCOVERY_WAIT_MS);
+        if (!changed && !first) {
+            continue;
+        }
+        first = false;
+
+        // The SDK's array is only valid until the next call - copy it out
+        uint32_t numSources = 0;
+        const NDIlib_source_t* found = NDIlib_find_get_current_sources(ndiFind_, &numSources);
+        std::vector<DiscoveredSource> sources;
+        sources.reserve(numSources);
         for (uint32_t i = 0; i < numSources; i++) {
-            if (std::string(sources[i].p_ndi_name).find(sourceName) != std::string::npos) {
-                selectedIndex = i;
+            sources.push_back({found[i].p_ndi_name ? found[i].p_ndi_name : "",
+                               found[i].p_url_address ? found[i].p_url_address : ""});
+        }
+
+        LT_LOG_INFO("Found %u NDI source(s)", numSources);
+        for (const DiscoveredSource& source : sources) {
+            LT_LOG_INFO("  %s", source.name);
+        }
+
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        sources_.swap(sources);
+    }
+#endif
+}
+
+bool NDIReceiver::tryConnect() {
+#ifdef ENABLE_NDI
+    // Select source: first one containing the requested name, or first available
+    DiscoveredSource selected;
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        for (const DiscoveredSource& source : sources_) {
+            if (requestedSourceName_.empty() || source.name.find(requestedSourceName_) != std::string::npos) {
+                selected = source;
                 break;
             }
         }
     }
 
-    if (selectedIndex < 0 || selectedIndex >= (int)numSources) {
-        std::cerr << "Could not find NDI source: " << sourceName << std::endl;
+    if (selected.name.empty()) {
         return false;
     }
 
     // Create receiver with low bandwidth settings
     NDIlib_recv_create_v3_t recvCreate;
     memset(&recvCreate, 0, sizeof(recvCreate));
-    recvCreate.source_to_connect_to = sources[selectedIndex];
+    recvCreate.source_to_connect_to.p_ndi_name = selected.name.c_str();
+    recvCreate.source_to_connect_to.p_url_address = selected.url.empty() ? nullptr : selected.url.c_str();
     recvCreate.bandwidth = NDIlib_recv_bandwidth_lowest; // Request preview/proxy stream
-    recvCreate.color_format = NDIlib_recv_color_format_BGRX_BGRA; // Easy to upload to OpenGL
+    // UYVY skips the SDK's CPU conversion and halves the upload; the sender converts it in a shader
+    recvCreate.color_format = preferUYVY_ ? NDIlib_recv_color_format_UYVY_BGRA : NDIlib_recv_color_format_BGRX_BGRA;
     recvCreate.allow_video_fields = false;
 
     ndiRecv_ = NDIlib_recv_create_v3(&recvCreate);
     if (!ndiRecv_) {
-        std::cerr << "Failed to create NDI receiver" << std::endl;
+        LT_LOG_WARNING("Failed to create NDI receiver for %s", selected.name);
         return false;
     }
 
-    currentSourceName_ = sources[selectedIndex].p_ndi_name;
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        currentSourceName_ = selected.name;
+    }
     connected_ = true;
+    lastFrameTime_ = std::chrono::steady_clock::now();
 
-    std::cout << "Connected to NDI source: " << currentSourceName_ << std::endl;
+    LT_LOG_INFO("Connected to NDI source: %s", selected.name);
     return true;
 #else
     return false;
 #endif
 }
 
-std::vector<std::string> NDIReceiver::getAvailableSources() {
-    std::vector<std::string> sourceNames;
-
+void NDIReceiver::destroyReceiver() {
 #ifdef ENABLE_NDI
-    if (!initialized_) {
-        return sourceNames;
-    }
-
-    // Wait a bit for sources
-    NDIlib_find_wait_for_sources(ndiFind_, 1000);
-
-    uint32_t numSources = 0;
-    const NDIlib_source_t* sources = NDIlib_find_get_current_sources(ndiFind_, &numSources);
-
-    for (uint32_t i = 0; i < numSources; i++) {
-        sourceNames.push_back(sources[i].p_ndi_name);
+    if (ndiRecv_) {
+        NDIlib_recv_destroy(ndiRecv_);
+        ndiRecv_ = nullptr;
     }
 #endif
-
-    return sourceNames;
+    connected_ = false;
+    std::lock_guard<std::mutex> lock(sourcesMutex_);
+    currentSourceName_.clear();
 }
 
-NDIFrame* NDIReceiver::captureFrame() {
+void NDIReceiver::captureNext() {
 #ifdef ENABLE_NDI
-    if (!connected_ || !ndiRecv_) {
-        return nullptr;
+    if (reconnectRequested_.exchange(false)) {
+        destroyReceiver();
     }
 
-    NDIlib_video_frame_v2_t videoFrame;
-    NDIlib_audio_frame_v3_t audioFrame;
-    NDIlib_metadata_frame_t metadataFrame;
+    // Not connected: wait for discovery to announce the source
+    if (!ndiRecv_) {
+        if (!tryConnect()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(CAPTURE_TIMEOUT_MS));
+        }
+        return;
+    }
 
-    // Non-blocking capture with 0ms timeout
+    // Audio and metadata aren't requested, so NDI discards them for us
+    NDIlib_video_frame_v2_t videoFrame;
     NDIlib_frame_type_e frameType = NDIlib_recv_capture_v3(
-        ndiRecv_, &videoFrame, &audioFrame, &metadataFrame, 0);
+        ndiRecv_, &videoFrame, nullptr, nullptr, CAPTURE_TIMEOUT_MS);
 
-    // Free audio/metadata if received
-    if (frameType == NDIlib_frame_type_audio) {
-        NDIlib_recv_free_audio_v3(ndiRecv_, &audioFrame);
-        return nullptr;
-    }
-    if (frameType == NDIlib_frame_type_metadata) {
-        NDIlib_recv_free_metadata(ndiRecv_, &metadataFrame);
-        return nullptr;
-    }
-
-    // Check if we got video
     if (frameType == NDIlib_frame_type_video) {
-        // Fill our frame structure
-        currentFrame_.data = videoFrame.p_data;
-        currentFrame_.width = videoFrame.xres;
-        currentFrame_.height = videoFrame.yres;
-        currentFrame_.stride = videoFrame.line_stride_in_bytes;
-        currentFrame_.timestamp = videoFrame.timestamp;
+        VideoPixelFormat format;
+        if (videoFrame.FourCC == NDIlib_FourCC_video_type_UYVY) {
+            format = VideoPixelFormat::UYVY;
+        } else if (videoFrame.FourCC == NDIlib_FourCC_video_type_BGRA ||
+                   videoFrame.FourCC == NDIlib_FourCC_video_type_BGRX) {
+            format = VideoPixelFormat::BGRA;
+        } else {
+            LT_LOG_WARNING("Skipping NDI frame in unsupported format 0x%x", static_cast<unsigned>(videoFrame.FourCC));
+            NDIlib_recv_free_video_v2(ndiRecv_, &videoFrame);
+            return;
+        }
 
-        // Note: We'll need to free this frame later with releaseFrame()
-        // Store the NDI frame pointer so we can free it properly
-        return &currentFrame_;
+        // Copy out and free at once - the SDK's frame pool must never wait on the UI
+        lastFrameTime_ = std::chrono::steady_clock::now();
+        deliverFrame(videoFrame.p_data, videoFrame.xres, videoFrame.yres, videoFrame.line_stride_in_bytes,
+                     format, static_cast<uint64_t>(videoFrame.timestamp));
+        NDIlib_recv_free_video_v2(ndiRecv_, &videoFrame);
+        return;
     }
 
-    // Handle status changes
     if (frameType == NDIlib_frame_type_status_change) {
-        std::cout << "NDI status changed" << std::endl;
+        LT_LOG_INFO("NDI status changed");
+    } else if (frameType == NDIlib_frame_type_error) {
+        LT_LOG_WARNING("NDI capture error on %s", getSourceName());
+        std::this_thread::sleep_for(std::chrono::milliseconds(CAPTURE_TIMEOUT_MS));
     }
-#endif
 
-    return nullptr;
-}
-
-void NDIReceiver::releaseFrame(NDIFrame* frame) {
-#ifdef ENABLE_NDI
-    if (!frame || !ndiRecv_) {
-        return;
+    // A silent source with no live connection has gone (or moved address) - let
+    // the next pass find it again from the discovery list, rather than freeze
+    auto silent = std::chrono::steady_clock::now() - lastFrameTime_;
+    if (silent > std::chrono::milliseconds(SOURCE_LOST_MS) && NDIlib_recv_get_no_connections(ndiRecv_) == 0) {
+        LT_LOG_WARNING("Lost NDI source %s - reconnecting when it is seen again", getSourceName());
+        destroyReceiver();
     }
-
-    // We need to free the NDI video frame
-    // Since we don't store the original NDIlib_video_frame_v2_t, we'll need to modify this
-    // For now, just clear our frame structure
-    memset(&currentFrame_, 0, sizeof(currentFrame_));
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(CAPTURE_TIMEOUT_MS));
 #endif
 }
 
 void NDIReceiver::disconnect() {
-#ifdef ENABLE_NDI
-    if (ndiRecv_) {
-        NDIlib_recv_destroy(ndiRecv_);
-        ndiRecv_ = nullptr;
-    }
-    connected_ = false;
-    currentSourceName_.clear();
-#endif
+    // The capture thread uses ndiRecv_ - it must be gone first
+    stopCapture();
+    destroyReceiver();
 }
 
 void NDIReceiver::shutdown() {
 #ifdef ENABLE_NDI
     disconnect();
 
+    discovering_ = false;
+    if (discoveryThread_.joinable()) {
+        discoveryThread_.join();
+    }
+
     if (ndiFind_) {
         NDIlib_find_destroy(ndiFind_);
         ndiFind_ = nullptr;
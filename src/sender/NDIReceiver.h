@@ -1,8 +1,12 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <cstdint>
-#include <functional>
+#include "VideoSource.h"
 
 #ifdef ENABLE_NDI
 #include <Processing.NDI.Lib.h>
@@ -14,56 +18,84 @@ typedef void* NDIlib_recv_instance_t;
 
 namespace LiveText {
 
-struct NDIFrame {
-    uint8_t* data;
-    int width;
-    int height;
-    int stride;
-    uint64_t timestamp;
-};
-
-class NDIReceiver {
+// Background video from an NDI source on the network.
+//
+// Nothing here waits on the network from the caller's thread: a discovery
+// thread keeps a live list of sources, and the capture thread connects to the
+// requested one as soon as it appears, drops it when it stops sending with no
+// live connection, and connects again once discovery sees it.
+class NDIReceiver : public VideoSource {
 public:
-    NDIReceiver();
-    ~NDIReceiver();
+    explicit NDIReceiver(const std::string& sourceName = "");
+    ~NDIReceiver() override;
 
-    // Initialize NDI library and find sources
+    // VideoSource: initialize() then connect() to the source given at construction
+    bool start() override;
+    void stop() override { shutdown(); }
+    bool isActive() const override { return isCapturing(); }
+    const char* getKind() const override { return "NDI"; }
+    std::string getName() const override;
+
+    // Initialize NDI library and start discovering sources in the background
     bool initialize();
 
-    // Connect to a specific NDI source by name (empty = first available)
+    // Connect to the first source whose name contains sourceName (empty = first available).
+    // Returns at once; the capture thread connects when the source is seen, and reconnects after it drops.
     bool connect(const std::string& sourceName = "");
 
-    // Get list of available NDI sources
-    std::vector<std::string> getAvailableSources();
-
-    // Capture the latest video frame (non-blocking)
-    // Returns nullptr if no new frame available
-    NDIFrame* captureFrame();
+    // Ask for UYVY instead of BGRA on the next connect(). Sources with alpha still arrive as BGRA.
+    void setPreferUYVY(bool prefer) { preferUYVY_ = prefer; }
 
-    // Release a captured frame back to NDI
-    void releaseFrame(NDIFrame* frame);
+    // Sources seen by the discovery thread, as of its last pass (non-blocking)
+    std::vector<std::string> getAvailableSources() const;
 
-    // Check if connected to a source
+    // Check if receiving from a source right now
     bool isConnected() const { return connected_; }
 
-    // Get current source name
-    std::string getSourceName() const { return currentSourceName_; }
+    // Get current source name (empty while searching)
+    std::string getSourceName() const;
 
-    // Disconnect from current source
+    // Disconnect from current source and stop looking for it
     void disconnect();
 
     // Shutdown NDI library
     void shutdown();
 
 private:
+    static constexpr uint32_t DISCOVERY_WAIT_MS = 1000;  // Longest discovery wait - bounds shutdown()
+    static constexpr int SOURCE_LOST_MS = 2000;          // No connection and no frames for this long = drop the source
+
+    struct DiscoveredSource {
+        std::string name;
+        std::string url;
+    };
+
     NDIlib_find_instance_t ndiFind_;
-    NDIlib_recv_instance_t ndiRecv_;
+    NDIlib_recv_instance_t ndiRecv_;    // Capture thread only while capturing
     bool initialized_;
-    bool connected_;
+    std::atomic<bool> connected_;
+    bool preferUYVY_;
+
+    // Discovery thread
+    std::thread discoveryThread_;
+    std::atomic<bool> discovering_;
+    void discoveryLoop();
+
+    // Shared between discovery, capture and UI threads
+    mutable std::mutex sourcesMutex_;
+    std::vector<DiscoveredSource> sources_;
+    std::string requestedSourceName_;
     std::string currentSourceName_;
+    std::atomic<bool> reconnectRequested_;
+
+    // Capture thread
+    std::chrono::steady_clock::time_point lastFrameTime_;
+    bool tryConnect();
+    void destroyReceiver();
 
-    // Frame data storage
-    NDIFrame currentFrame_;
+    // Capture thread: frees every NDI frame right after copying it into the handoff,
+    // so the SDK never holds more than the frame being copied
+    void captureNext() override;
 };
 
 } // namespace LiveText
@@ -0,0 +1,125 @@
+#include "OverlayTextLayout.h"
+#include <imgui.h>
+#include <algorithm>
+
+namespace LiveText {
+
+namespace {
+
+// One UTF-8 sequence as ImGui reads it; malformed bytes count as U+FFFD, one at a time
+int decodeUtf8(const char* text, const char* end, unsigned int& codepoint) {
+    unsigned char lead = static_cast<unsigned char>(text[0]);
+    int length = lead < 0x80 ? 1 : (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : (lead & 0xF8) == 0xF0 ? 4 : 0;
+    if (length == 1) {
+        codepoint = lead;
+        return 1;
+    }
+    if (length == 0 || text + length > end) {
+        codepoint = IM_UNICODE_CODEPOINT_INVALID;
+        return 1;
+    }
+
+    codepoint = lead & (0x7F >> length);
+    for (int i = 1; i < length; ++i) {
+        unsigned char next = static_cast<unsigned char>(text[i]);
+        if ((next & 0xC0) != 0x80) {
+            codepoint = IM_UNICODE_CODEPOINT_INVALID;
+            return 1;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    if (codepoint > IM_UNICODE_CODEPOINT_MAX) {
+        codepoint = IM_UNICODE_CODEPOINT_INVALID;
+    }
+    return length;
+}
+
+} // namespace
+
+OverlayTextLayout::OverlayTextLayout()
+    : font_(nullptr)
+    , boxWidth_(0.0f)
+    , boxHeight_(0.0f)
+    , lineHeight_(0.0f)
+    , top_(0.0f)
+    , rebuilds_(0)
+{
+    lines_.push_back({0, 0, 0.0f, 0.0f});
+    offsets_.push_back(0.0f);
+}
+
+bool OverlayTextLayout::update(const char* text, ImFont* font, float boxWidth, float boxHeight) {
+    if (font == font_ && boxWidth == boxWidth_ && boxHeight == boxHeight_ && text_ == text) {
+        return false;
+    }
+
+    text_ = text;
+    font_ = font;
+    boxWidth_ = boxWidth;
+    boxHeight_ = boxHeight;
+    rebuild();
+    return true;
+}
+
+void OverlayTextLayout::rebuild() {
+    rebuilds_++;
+    lines_.clear();
+    offsets_.assign(text_.size() + 1, 0.0f);
+    lineHeight_ = font_ ? font_->FontSize : 0.0f;
+
+    // Same advances CalcTextSizeA sums at the font's own size, so the overlay matches the widget
+    const char* begin = text_.c_str();
+    const char* end = begin + text_.size();
+    Line line = {0, 0, 0.0f, 0.0f};
+    float x = 0.0f;
+
+    for (const char* p = begin; p < end;) {
+        int pos = static_cast<int>(p - begin);
+        offsets_[pos] = x;
+
+        if (*p == '\n') {
+            line.end = pos;
+            line.width = x;
+            lines_.push_back(line);
+            line.begin = pos + 1;
+            x = 0.0f;
+            ++p;
+            continue;
+        }
+
+        unsigned int codepoint;
+        int length = decodeUtf8(p, end, codepoint);
+        for (int i = 1; i < length; ++i) {
+            offsets_[pos + i] = x;      // Never a caret position, but keep lookups in range
+        }
+        if (codepoint != '\r' && font_) {
+            x += font_->GetCharAdvance(static_cast<ImWchar>(codepoint));
+        }
+        p += length;
+    }
+
+    // The last line - empty after a trailing '\n', as the widget shows it
+    offsets_[text_.size()] = x;
+    line.end = static_cast<int>(text_.size());
+    line.width = x;
+    lines_.push_back(line);
+
+    for (Line& l : lines_) {
+        l.x = (boxWidth_ - l.width) * 0.5f;
+    }
+    top_ = (boxHeight_ - lineHeight_ * lines_.size()) * 0.5f;
+}
+
+size_t OverlayTextLayout::lineOf(int pos) const {
+    // Last line starting at or before pos - a caret just before '\n' stays on its line
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), pos,
+                               [](int value, const Line& line) { return value < line.begin; });
+    return it == lines_.begin() ? 0 : static_cast<size_t>(it - lines_.begin()) - 1;
+}
+
+float OverlayTextLayout::caretX(int pos) const {
+    pos = std::max(0, std::min(pos, static_cast<int>(text_.size())));
+    return lines_[lineOf(pos)].x + offsets_[pos];
+}
+
+} // namespace LiveText
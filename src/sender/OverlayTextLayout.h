@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ImFont;
+
+namespace LiveText {
+
+// Centered multi-line layout of the sender's text overlay, cached.
+//
+// The text is split at '\n' and every line measured once, glyph by glyph,
+// when the text, font or box size changes. Each caret position (byte offset)
+// then has its x stored, so drawing lines, selection and the caret are
+// lookups. Coordinates are relative to the box's top-left corner.
+class OverlayTextLayout {
+public:
+    struct Line {
+        int begin;      // Byte range in text(), '\n' excluded
+        int end;
+        float x;        // Left edge - the line is centered in the box
+        float width;
+    };
+
+    OverlayTextLayout();
+
+    // Re-measure if anything the layout depends on changed. Returns true if it did.
+    bool update(const char* text, ImFont* font, float boxWidth, float boxHeight);
+
+    const std::string& text() const { return text_; }
+    const std::vector<Line>& lines() const { return lines_; }
+    float lineHeight() const { return lineHeight_; }
+    float lineY(size_t line) const { return top_ + line * lineHeight_; }
+
+    // Line holding caret position pos (clamped to the text)
+    size_t lineOf(int pos) const;
+
+    // x of the caret before byte pos, relative to the box
+    float caretX(int pos) const;
+
+    uint64_t getRebuildCount() const { return rebuilds_; }
+
+private:
+    std::string text_;
+    ImFont* font_;
+    float boxWidth_;
+    float boxHeight_;
+
+    std::vector<Line> lines_;
+    std::vector<float> offsets_;    // text_.size() + 1 entries: caret x within its line
+    float lineHeight_;
+    float top_;
+    uint64_t rebuilds_;
+
+    void rebuild();
+};
+
+} // namespace LiveText
@@ -1,23 +1,32 @@
 #include "SenderApp.h"
+#include "common/Logger.h"
+#include "SyntheticVideoSource.h"
+#include "FileVideoSource.h"
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 #include <OpenGL/gl.h>
 #include <OpenGL/gl3.h>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <vector>
 #include <cmath>
-#include <sstream>
 
 namespace LiveText {
 
-SenderApp::SenderApp()
-    : window_(nullptr)
-    , ndiTexture_(0)
-    , ndiTextureWidth_(0)
-    , ndiTextureHeight_(0)
+SenderApp::SenderApp(const SenderConfig& config)
+    : config_(config)
+    , window_(nullptr)
+    , hasFitReport_(false)
+    , standbyCue_(0)
+    , liveCue_(SIZE_MAX)
+    , preloadedFrom_(SIZE_MAX)
+    , preloadQueued_(0)
+    , scrollToStandby_(false)
+    , ndiReceiver_(nullptr)
     , currentTextSize_(TextSize::SMALL)
     , autoSendEnabled_(true)
     , showCharacterCount_(true)
@@ -29,6 +38,15 @@ SenderApp::SenderApp()
     , selectionEnd_(-1)
     , isFading_(false)
     , fadeAlpha_(0.0f)
+    , lastInputTime_(std::chrono::steady_clock::now())
+    , lastHealthUpdate_()
+    , activeFrames_(0)
+    , idleFrames_(0)
+    , activeSeconds_(0.0)
+    , idleSeconds_(0.0)
+    , activeFps_(0.0)
+    , idleFps_(0.0)
+    , idleShare_(0.0)
 {
     memset(textBuffer_, 0, sizeof(textBuffer_));
 }
@@ -99,6 +117,17 @@ bool SenderApp::initialize() {
 
     setupDarkTheme();
 
+    // Input wakes the idle loop. Installed first so ImGui's callbacks chain to these.
+    glfwSetWindowUserPointer(window_, this);
+    glfwSetKeyCallback(window_, [](GLFWwindow* w, int, int, int, int) { onInputEvent(w); });
+    glfwSetCharCallback(window_, [](GLFWwindow* w, unsigned int) { onInputEvent(w); });
+    glfwSetMouseButtonCallback(window_, [](GLFWwindow* w, int, int, int) { onInputEvent(w); });
+    glfwSetCursorPosCallback(window_, [](GLFWwindow* w, double, double) { onInputEvent(w); });
+    glfwSetScrollCallback(window_, [](GLFWwindow* w, double, double) { onInputEvent(w); });
+    glfwSetWindowFocusCallback(window_, [](GLFWwindow* w, int) { onInputEvent(w); });
+    glfwSetCursorEnterCallback(window_, [](GLFWwindow* w, int) { onInputEvent(w); });
+    glfwSetFramebufferSizeCallback(window_, [](GLFWwindow* w, int, int) { onInputEvent(w); });
+
     ImGui_ImplGlfw_InitForOpenGL(window_, true);
     ImGui_ImplOpenGL3_Init("#version 330");
 
@@ -107,26 +136,76 @@ bool SenderApp::initialize() {
     textMemory_ = std::make_unique<TextMemory>();
 
     // Initialize Aeron publisher
-    publisher_ = std::make_unique<DualAeronPublisher>(PRIMARY_CHANNEL, SECONDARY_CHANNEL, STREAM_ID);
+    publisher_ = std::make_unique<AsyncPublisher>(PRIMARY_CHANNEL, SECONDARY_CHANNEL, STREAM_ID,
+                                                  config_.refreshWithText, config_.presentationDelayMs);
 
     if (!publisher_->initialize()) {
         std::cerr << "Failed to initialize Aeron publisher" << std::endl;
         return false;
     }
 
-    // Initialize NDI (optional - continues if it fails)
-    initializeNDI();
+    // Fit reports, state requests and clock pings from the receivers (optional - the sender works without them)
+    feedbackSubscriber_ = std::make_unique<AeronSubscriber>(std::vector<std::string>{FEEDBACK_CHANNEL},
+                                                             FEEDBACK_STREAM_ID);
+    if (feedbackSubscriber_->initialize()) {
+        feedbackSubscriber_->setMessageCallback([this](const TextMessage& message, int) {
+            if (message.type == MessageType::CLOCK_PING) {
+                publisher_->answerPing(message);
+            } else if (message.type == MessageType::STATE_REQUEST) {
+                publisher_->requestSnapshot();
+            } else if (message.type == MessageType::PRESENT_REPORT) {
+                std::lock_guard<std::mutex> lock(skewMutex_);
+                recordFlip(message);
+            } else if (message.type == MessageType::FIT_REPORT) {
+                std::lock_guard<std::mutex> lock(fitMutex_);
+                lastFitReport_ = message;
+                hasFitReport_ = true;
+                glfwPostEmptyEvent();   // Show it now, even if the UI is idle
+            }
+        });
+        feedbackSubscriber_->start();
+    } else {
+        std::cerr << "Failed to initialize feedback subscriber - receiver fit will not be shown" << std::endl;
+        feedbackSubscriber_.reset();
+    }
+
+    // Cue list (optional - live typing works without one)
+    if (!config_.showFile.empty() && cueList_.load(config_.showFile)) {
+        preloadCues();
+    }
+
+    // Initialize the video background (optional - continues if it fails)
+    initializeVideoSource();
 
     running_ = true;
     return true;
 }
 
 void SenderApp::run() {
+    auto frameStart = std::chrono::steady_clock::now();
     while (running_ && !glfwWindowShouldClose(window_)) {
-        glfwPollEvents();
+        // Full rate while something is changing; otherwise sleep until input,
+        // a video frame or a fit report posts an event, or IDLE_WAIT_SECONDS pass
+        bool idle = !needsFullRate();
+        if (idle) {
+            glfwWaitEventsTimeout(IDLE_WAIT_SECONDS);
+        } else {
+            glfwPollEvents();
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        updateFrameRates(idle, std::chrono::duration<double>(now - frameStart).count());
+        frameStart = now;
 
-        // Update health monitoring
-        updateHealthMonitoring();
+        // Queue text held back while the publish queue was full
+        publisher_->flush();
+        preloadCues();
+
+        // Update health monitoring - a few times a second is plenty for the status panel
+        if (std::chrono::duration<double>(now - lastHealthUpdate_).count() >= HEALTH_UPDATE_SECONDS) {
+            updateHealthMonitoring();
+            lastHealthUpdate_ = now;
+        }
 
         // Check for static text that should be moved to memory
         if (textMemory_) {
@@ -136,8 +215,8 @@ void SenderApp::run() {
         // Update fade animation
         updateFade();
 
-        // Update NDI texture from latest frame
-        updateNDITexture();
+        // Update video texture from latest frame
+        updateVideoTexture();
 
         // Start ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -163,8 +242,13 @@ void SenderApp::run() {
 void SenderApp::shutdown() {
     running_ = false;
 
-    // Shutdown NDI
-    shutdownNDI();
+    // Shutdown the video background
+    shutdownVideoSource();
+
+    if (feedbackSubscriber_) {
+        feedbackSubscriber_->shutdown();
+        feedbackSubscriber_.reset();
+    }
 
     if (publisher_) {
         publisher_->shutdown();
@@ -216,6 +300,12 @@ void SenderApp::renderMainWindow() {
 
     // Text memory takes remaining middle space
     float memoryHeight = windowHeight * 0.3f; // 30% of window height
+    if (cueList_.isLoaded()) {
+        ImGui::BeginChild("CueListArea", ImVec2(windowWidth * 0.5f, memoryHeight), true);
+        renderCueList();
+        ImGui::EndChild();
+        ImGui::SameLine();
+    }
     ImGui::BeginChild("TextMemoryArea", ImVec2(0, memoryHeight), true);
     renderTextMemory();
     ImGui::EndChild();
@@ -325,172 +415,80 @@ void SenderApp::renderTextInput() {
     ImVec2 widgetMin = ImGui::GetItemRectMin();
     ImVec2 widgetMax = ImGui::GetItemRectMax();
 
-    // Render NDI video background behind the input field (AFTER widget is drawn)
-    renderNDIBackground(ImVec2(0, 0), ImVec2(inputWidth, inputHeight));
+    // Render video background behind the input field (AFTER widget is drawn)
+    renderVideoBackground(ImVec2(0, 0), ImVec2(inputWidth, inputHeight));
 
     // Render custom centered text overlay with cursor and selection
     if (abfFont != nullptr) {
         ImDrawList* drawList = ImGui::GetWindowDrawList();
 
+        float widgetWidth = widgetMax.x - widgetMin.x;
+        float widgetHeight = widgetMax.y - widgetMin.y;
+
         // Render fading text if fade is active
         if (isFading_ && !fadingText_.empty()) {
-            // Split fading text into lines for individual centering
-            std::vector<std::string> fadeLines;
-            std::stringstream fadeStream(fadingText_);
-            std::string fadeLine;
-
-            while (std::getline(fadeStream, fadeLine, '\n')) {
-                fadeLines.push_back(fadeLine);
-            }
-
-            // Handle case where text ends with newline
-            if (fadingText_.back() == '\n') {
-                fadeLines.push_back("");
-            }
-
-            // Calculate total text height for vertical centering
-            float lineHeight = abfFont->FontSize;
-            float totalTextHeight = lineHeight * fadeLines.size();
-            float startY = widgetMin.y + (widgetMax.y - widgetMin.y - totalTextHeight) * 0.5f;
-
-            float widgetWidth = widgetMax.x - widgetMin.x;
+            fadeLayout_.update(fadingText_.c_str(), abfFont, widgetWidth, widgetHeight);
+            const std::string& text = fadeLayout_.text();
 
             // Apply exponential fade alpha
             int alpha = (int)(255 * fadeAlpha_);
 
             // Draw each fading line centered
-            for (size_t i = 0; i < fadeLines.size(); ++i) {
-                const std::string& currentLine = fadeLines[i];
-
-                if (!currentLine.empty()) {
-                    // Calculate centered position for this line
-                    ImVec2 lineSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, currentLine.c_str());
-                    float lineX = widgetMin.x + (widgetWidth - lineSize.x) * 0.5f;
-                    float lineY = startY + i * lineHeight;
-
-                    // Draw the fading line
-                    drawList->AddText(abfFont, abfFont->FontSize, ImVec2(lineX, lineY), IM_COL32(255, 255, 255, alpha), currentLine.c_str());
+            const std::vector<OverlayTextLayout::Line>& lines = fadeLayout_.lines();
+            for (size_t i = 0; i < lines.size(); ++i) {
+                if (lines[i].begin < lines[i].end) {
+                    ImVec2 linePos(widgetMin.x + lines[i].x, widgetMin.y + fadeLayout_.lineY(i));
+                    drawList->AddText(abfFont, abfFont->FontSize, linePos, IM_COL32(255, 255, 255, alpha),
+                                      text.c_str() + lines[i].begin, text.c_str() + lines[i].end);
                 }
             }
         }
 
         // Render active text with cursor and selection (only if not fading)
-        if (!isFading_ && strlen(textBuffer_) > 0) {
-            // Split text into lines for individual centering
-            std::string fullText(textBuffer_);
-            std::vector<std::string> lines;
-            std::stringstream ss(fullText);
-            std::string line;
-
-            while (std::getline(ss, line, '\n')) {
-                lines.push_back(line);
-            }
-
-            // Handle case where text ends with newline
-            if (fullText.back() == '\n') {
-                lines.push_back("");
-            }
-
-            // Calculate total text height for vertical centering
-            float lineHeight = abfFont->FontSize;
-            float totalTextHeight = lineHeight * lines.size();
-            float startY = widgetMin.y + (widgetMax.y - widgetMin.y - totalTextHeight) * 0.5f;
-
-            float widgetWidth = widgetMax.x - widgetMin.x;
-
-            // Keep track of character position for cursor/selection calculation
-            int charPos = 0;
+        if (!isFading_ && textBuffer_[0] != '\0') {
+            // Re-measured only when the text, font or widget size changed
+            inputLayout_.update(textBuffer_, abfFont, widgetWidth, widgetHeight);
+            const std::string& text = inputLayout_.text();
+            const std::vector<OverlayTextLayout::Line>& lines = inputLayout_.lines();
+            float lineHeight = inputLayout_.lineHeight();
 
             // Draw selection background if there is a selection
             if (selectionStart_ != selectionEnd_ && selectionStart_ >= 0 && selectionEnd_ >= 0) {
                 int selStart = std::min(selectionStart_, selectionEnd_);
                 int selEnd = std::max(selectionStart_, selectionEnd_);
 
-                int lineCharPos = 0;
-                for (size_t i = 0; i < lines.size(); ++i) {
-                    const std::string& currentLine = lines[i];
-                    int lineEndPos = lineCharPos + currentLine.length();
-
-                    // Check if selection intersects with this line
-                    if (selStart <= lineEndPos && selEnd > lineCharPos) {
-                        // Calculate line position
-                        ImVec2 lineSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, currentLine.c_str());
-                        float lineX = widgetMin.x + (widgetWidth - lineSize.x) * 0.5f;
-                        float lineY = startY + i * lineHeight;
-
-                        // Calculate selection within this line
-                        int lineSelStart = std::max(0, selStart - lineCharPos);
-                        int lineSelEnd = std::min((int)currentLine.length(), selEnd - lineCharPos);
-
-                        if (lineSelStart < lineSelEnd) {
-                            std::string beforeSel = currentLine.substr(0, lineSelStart);
-                            std::string selectedText = currentLine.substr(lineSelStart, lineSelEnd - lineSelStart);
-
-                            ImVec2 beforeSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, beforeSel.c_str());
-                            ImVec2 selectedSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, selectedText.c_str());
-
-                            // Draw selection rectangle
-                            ImVec2 selMin(lineX + beforeSize.x, lineY);
-                            ImVec2 selMax(lineX + beforeSize.x + selectedSize.x, lineY + lineHeight);
-                            drawList->AddRectFilled(selMin, selMax, IM_COL32(76, 153, 255, 200)); // Blue selection
-                        }
+                for (size_t i = inputLayout_.lineOf(selStart); i < lines.size() && lines[i].begin < selEnd; ++i) {
+                    int lineSelStart = std::max(selStart, lines[i].begin);
+                    int lineSelEnd = std::min(selEnd, lines[i].end);
+                    if (lineSelStart < lineSelEnd) {
+                        float lineY = widgetMin.y + inputLayout_.lineY(i);
+                        ImVec2 selMin(widgetMin.x + inputLayout_.caretX(lineSelStart), lineY);
+                        ImVec2 selMax(widgetMin.x + inputLayout_.caretX(lineSelEnd), lineY + lineHeight);
+                        drawList->AddRectFilled(selMin, selMax, IM_COL32(76, 153, 255, 200)); // Blue selection
                     }
-
-                    lineCharPos = lineEndPos + 1; // +1 for the newline character
                 }
             }
 
             // Draw each line centered
-            charPos = 0;
             for (size_t i = 0; i < lines.size(); ++i) {
-                const std::string& currentLine = lines[i];
-
-                if (!currentLine.empty()) {
-                    // Calculate centered position for this line
-                    ImVec2 lineSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, currentLine.c_str());
-                    float lineX = widgetMin.x + (widgetWidth - lineSize.x) * 0.5f;
-                    float lineY = startY + i * lineHeight;
-
-                    // Draw the line
-                    drawList->AddText(abfFont, abfFont->FontSize, ImVec2(lineX, lineY), IM_COL32(255, 255, 255, 255), currentLine.c_str());
+                if (lines[i].begin < lines[i].end) {
+                    ImVec2 linePos(widgetMin.x + lines[i].x, widgetMin.y + inputLayout_.lineY(i));
+                    drawList->AddText(abfFont, abfFont->FontSize, linePos, IM_COL32(255, 255, 255, 255),
+                                      text.c_str() + lines[i].begin, text.c_str() + lines[i].end);
                 }
-
-                charPos += currentLine.length() + 1; // +1 for newline
             }
 
             // Draw cursor if input is active
             if (ImGui::IsItemActive()) {
-                // Find which line the cursor is on and position within that line
-                int lineCharPos = 0;
-                for (size_t i = 0; i < lines.size(); ++i) {
-                    const std::string& currentLine = lines[i];
-                    int lineEndPos = lineCharPos + currentLine.length();
-
-                    if (cursorPos_ >= lineCharPos && cursorPos_ <= lineEndPos) {
-                        // Cursor is on this line
-                        int cursorInLine = cursorPos_ - lineCharPos;
-                        std::string beforeCursor = currentLine.substr(0, cursorInLine);
-
-                        // Calculate line position
-                        ImVec2 lineSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, currentLine.c_str());
-                        float lineX = widgetMin.x + (widgetWidth - lineSize.x) * 0.5f;
-                        float lineY = startY + i * lineHeight;
-
-                        ImVec2 beforeCursorSize = abfFont->CalcTextSizeA(abfFont->FontSize, FLT_MAX, 0.0f, beforeCursor.c_str());
-
-                        // Blinking cursor animation
-                        float time = (float)ImGui::GetTime();
-                        float cursorAlpha = (fmod(time, 1.0f) < 0.5f) ? 1.0f : 0.0f;
-
-                        // Draw cursor line
-                        ImVec2 cursorPosVec(lineX + beforeCursorSize.x, lineY);
-                        ImVec2 cursorEnd(lineX + beforeCursorSize.x, lineY + lineHeight);
-                        drawList->AddLine(cursorPosVec, cursorEnd, IM_COL32(255, 255, 255, (int)(255 * cursorAlpha)), 2.0f);
-                        break;
-                    }
-
-                    lineCharPos = lineEndPos + 1; // +1 for the newline character
-                }
+                // Blinking cursor animation
+                float time = (float)ImGui::GetTime();
+                float cursorAlpha = (fmod(time, 1.0f) < 0.5f) ? 1.0f : 0.0f;
+
+                // Draw cursor line
+                float cursorX = widgetMin.x + inputLayout_.caretX(cursorPos_);
+                float cursorY = widgetMin.y + inputLayout_.lineY(inputLayout_.lineOf(cursorPos_));
+                drawList->AddLine(ImVec2(cursorX, cursorY), ImVec2(cursorX, cursorY + lineHeight),
+                                  IM_COL32(255, 255, 255, (int)(255 * cursorAlpha)), 2.0f);
             }
         }
     }
@@ -541,18 +539,16 @@ void SenderApp::renderTextInput() {
         fadingText_.clear();
     }
 
-    // DEBUG: Log all relevant state
-    std::cout << "DEBUG: textChanged=" << textChanged
-              << ", textBuffer_='" << textBuffer_ << "'"
-              << ", lastSentText_='" << lastSentText_ << "'"
-              << ", isFading_=" << isFading_ << std::endl;
+    // Per-frame state - compiled out of release builds
+    LT_LOG_TRACE("DEBUG: textChanged=%d, textBuffer_='%s', lastSentText_='%s', isFading_=%d",
+                 textChanged, textBuffer_, lastSentText_, isFading_);
 
     // Check if text was completely cleared BEFORE sending (so we don't lose lastSentText_)
     bool shouldStartFadeOut = textChanged && strlen(textBuffer_) == 0 && !lastSentText_.empty() && !isFading_;
     std::string textToFade = lastSentText_; // Save it before it potentially gets cleared
 
     if (shouldStartFadeOut) {
-        std::cout << "DEBUG: Will start fade-out with text: '" << textToFade << "'" << std::endl;
+        LT_LOG_DEBUG("DEBUG: Will start fade-out with text: '%s'", textToFade);
     }
 
     // Send text immediately with zero latency for real text changes only
@@ -567,7 +563,7 @@ void SenderApp::renderTextInput() {
         isFading_ = true;
         fadeAlpha_ = 1.0f;
         fadeStartTime_ = std::chrono::steady_clock::now();
-        std::cout << "FADE-OUT: Starting fade-out animation with text: '" << fadingText_ << "'" << std::endl;
+        LT_LOG_DEBUG("FADE-OUT: Starting fade-out animation with text: '%s'", fadingText_);
     }
 }
 
@@ -594,12 +590,49 @@ void SenderApp::renderControlButtons() {
     // Current settings
     ImGui::Spacing();
     ImGui::Text("Current Size: %s", (currentTextSize_ == TextSize::BIG) ? "Big" : "Small");
+    renderFitStatus();
 
     // Keyboard shortcuts toggle
     ImGui::Spacing();
     ImGui::Checkbox("Show keyboard shortcuts", &showKeyboardShortcuts_);
 }
 
+void SenderApp::renderFitStatus() {
+    if (textBuffer_[0] == '\0') {
+        return;
+    }
+
+    TextMessage report;
+    bool hasReport;
+    {
+        std::lock_guard<std::mutex> lock(fitMutex_);
+        report = lastFitReport_;
+        hasReport = hasFitReport_;
+    }
+
+    if (!hasReport) {
+        ImGui::TextDisabled("Receiver fit: no report yet");
+        return;
+    }
+    if (report.getText() != textBuffer_ || report.size != currentTextSize_) {
+        ImGui::TextDisabled("Receiver fit: waiting...");
+        return;
+    }
+
+    // Warn before the cue goes on air smaller than intended
+    if (report.fitFlags & FIT_CLIPPED) {
+        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Receiver fit: TOO LONG - overflows the safe area at %.0f%% (%u lines)",
+                          report.fitScale * 100.0f, static_cast<unsigned>(report.fitLines));
+    } else if (report.fitFlags & FIT_SHRUNK) {
+        ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Receiver fit: shrunk to %.0f%% (%u lines)",
+                          report.fitScale * 100.0f, static_cast<unsigned>(report.fitLines));
+    } else {
+        ImGui::TextColored(ImVec4(0.6f, 1.0f, 0.6f, 1.0f), "Receiver fit: full size (%u %s%s)",
+                          static_cast<unsigned>(report.fitLines), report.fitLines == 1 ? "line" : "lines",
+                          (report.fitFlags & FIT_WRAPPED) ? ", wrapped" : "");
+    }
+}
+
 void SenderApp::renderHealthStatus() {
     ImGui::Text("System Health");
 
@@ -629,7 +662,7 @@ void SenderApp::renderHealthStatus() {
     ImGui::Text("Network Status");
 
     if (publisher_) {
-        auto stats = publisher_->getStats();
+        auto stats = publisher_->getConnectionStats();
 
         // Display traffic lights for each feed
         for (size_t i = 0; i < stats.size(); ++i) {
@@ -731,7 +764,7 @@ void SenderApp::renderConnectionStatus() {
     ImGui::Text("Connection Status");
 
     if (publisher_) {
-        auto stats = publisher_->getStats();
+        auto stats = publisher_->getConnectionStats();
 
         for (size_t i = 0; i < stats.size(); ++i) {
             const auto& stat = stats[i];
@@ -750,6 +783,67 @@ void SenderApp::renderConnectionStatus() {
 
         bool healthy = publisher_->isHealthy();
         ImGui::Text("Overall: %s", healthy ? "HEALTHY" : "DEGRADED");
+
+        const PublishQueueStats& queue = publisher_->getStats();
+        ImGui::Text("Queue: %zu waiting (max %zu), %.2f ms avg, %.2f ms max to wire",
+                    queue.depth, queue.maxDepth, queue.avgLatencyMs, queue.maxLatencyMs);
+        ImGui::Text("State: revision %u, %llu refreshes, %llu requested by receivers",
+                    publisher_->getRevision(), static_cast<unsigned long long>(queue.refreshes),
+                    static_cast<unsigned long long>(queue.stateRequests));
+        if (queue.retries > 0 || queue.failed > 0 || queue.rejected > 0) {
+            ImGui::TextDisabled("  %llu retries, %llu failed, %llu rejected",
+                                static_cast<unsigned long long>(queue.retries),
+                                static_cast<unsigned long long>(queue.failed),
+                                static_cast<unsigned long long>(queue.rejected));
+        }
+
+        FlipSkew skew;
+        {
+            std::lock_guard<std::mutex> lock(skewMutex_);
+            skew = flipSkew_;
+        }
+        if (!skew.peers.empty()) {
+            ImGui::Text("Flip: %zu %s within %.2f ms (revision %u), last %.2f ms after the presentation time",
+                        skew.peers.size(), skew.peers.size() == 1 ? "screen" : "screens",
+                        (skew.latest - skew.earliest) / 1000.0, skew.revision, skew.worstLateUs / 1000.0);
+        } else if (config_.presentationDelayMs > 0) {
+            ImGui::TextDisabled("Flip: presenting %d ms after send - no receiver reports yet", config_.presentationDelayMs);
+        }
+    }
+
+    if (videoSource_ && videoSource_->isActive()) {
+        const VideoCaptureStats& video = videoSource_->getStats();
+        ImGui::Text("Video: %s - %s", videoSource_->getKind(), videoSource_->getName().c_str());
+        ImGui::Text("  Captured %.1f fps | Shown %.1f fps | Dropped %.1f fps",
+                    video.capturedFps, video.deliveredFps, video.droppedFps);
+        ImGui::Text("  Source %dx%d, downscaled %dx (%s, %.2f ms per frame)",
+                    video.sourceWidth, video.sourceHeight, video.downscaleFactor, video.downscaleKernel, video.downscaleMs);
+        if (videoUploader_) {
+            const VideoUploadStats& upload = videoUploader_->getStats();
+            ImGui::Text("  Upload %.2f ms avg, %.2f ms max, %.0f MB/s (%dx%d %s)",
+                        upload.avgUploadMs, upload.maxUploadMs, upload.uploadMBps,
+                        videoUploader_->getWidth(), videoUploader_->getHeight(),
+                        videoUploader_->getFormat() == VideoPixelFormat::UYVY ? "UYVY" : "BGRA");
+        }
+    }
+
+    ImGui::Text("UI: %.1f fps active, %.1f fps idle (idle %.0f%% of the time)",
+                activeFps_, idleFps_, idleShare_ * 100.0);
+
+    // Live list from the discovery thread - picking one reconnects in the background
+    if (ndiReceiver_) {
+        std::string current = ndiReceiver_->getSourceName();
+        if (ImGui::BeginCombo("NDI Source", current.empty() ? "(searching)" : current.c_str())) {
+            if (ImGui::Selectable("First available", false)) {
+                ndiReceiver_->connect("");
+            }
+            for (const std::string& source : ndiReceiver_->getAvailableSources()) {
+                if (ImGui::Selectable(source.c_str(), source == current)) {
+                    ndiReceiver_->connect(source);
+                }
+            }
+            ImGui::EndCombo();
+        }
     }
 }
 
@@ -776,12 +870,141 @@ void SenderApp::renderTextMemory() {
     ImGui::EndChild();
 }
 
+void SenderApp::renderCueList() {
+    ImGui::Text("Cue List (%zu cues)", cueList_.size());
+    ImGui::SameLine();
+    if (ImGui::Button("GO", ImVec2(80, 0))) {
+        goCue();
+    }
+    ImGui::SameLine();
+    if (standbyCue_ < cueList_.size()) {
+        ImGui::Text("Standby: cue %u", CueList::cueId(standbyCue_));
+    } else {
+        ImGui::TextDisabled("End of list");
+    }
+
+    if (ImGui::BeginChild("CueListScroll", ImVec2(0, 0), false)) {
+        float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+        if (scrollToStandby_) {
+            // Keep a couple of taken cues in view above the standby one
+            ImGui::SetScrollY(std::max(0.0f, (static_cast<float>(standbyCue_) - 2.0f) * rowHeight));
+            scrollToStandby_ = false;
+        }
+
+        // Only the rows on screen are formatted, however long the show
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(cueList_.size()), rowHeight);
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                size_t index = static_cast<size_t>(row);
+                size_t length = 0;
+                const char* line = cueList_.firstLine(index, length);
+
+                char label[128];
+                snprintf(label, sizeof(label), "%4u  %s%.*s##cue", CueList::cueId(index),
+                         cueList_.textSize(index) == TextSize::BIG ? "[BIG] " : "",
+                         static_cast<int>(std::min<size_t>(length, 80)), line);
+
+                bool live = index == liveCue_;
+                if (live) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.6f, 1.0f, 0.6f, 1.0f));
+                }
+                ImGui::PushID(row);
+                if (ImGui::Selectable(label, index == standbyCue_)) {
+                    setStandbyCue(index);
+                }
+                ImGui::PopID();
+                if (live) {
+                    ImGui::PopStyleColor();
+                }
+            }
+        }
+        clipper.End();
+    }
+    ImGui::EndChild();
+}
+
+void SenderApp::setStandbyCue(size_t index) {
+    standbyCue_ = std::min(index, cueList_.size());
+    preloadCues();
+}
+
+void SenderApp::preloadCues() {
+    if (!publisher_ || standbyCue_ >= cueList_.size()) {
+        return;
+    }
+
+    // Preloads would only be refused until the held-back text is queued
+    if (publisher_->hasHeldBack()) {
+        return;
+    }
+
+    // Receivers keep cues they already have staged, so the resend for late joiners costs them nothing
+    auto now = std::chrono::steady_clock::now();
+    if (preloadedFrom_ == SIZE_MAX ||
+        std::chrono::duration<double>(now - lastPreload_).count() >= CUE_PRELOAD_RESEND_SECONDS) {
+        preloadQueued_ = 0;
+        lastPreload_ = now;
+    } else if (standbyCue_ > preloadedFrom_) {
+        // Cues still in the moved window stay queued
+        size_t moved = standbyCue_ - preloadedFrom_;
+        preloadQueued_ = moved < CUE_PRELOAD_COUNT ? preloadQueued_ >> moved : 0;
+    } else if (standbyCue_ < preloadedFrom_) {
+        size_t moved = preloadedFrom_ - standbyCue_;
+        preloadQueued_ = moved < CUE_PRELOAD_COUNT ? preloadQueued_ << moved : 0;
+    }
+    preloadedFrom_ = standbyCue_;
+    preloadQueued_ &= (1u << CUE_PRELOAD_COUNT) - 1;
+
+    // Queue full - the rest go next frame
+    size_t count = std::min(cueList_.size() - standbyCue_, CUE_PRELOAD_COUNT);
+    for (size_t n = 0; n < count; ++n) {
+        if (preloadQueued_ & (1u << n)) {
+            continue;
+        }
+        size_t i = standbyCue_ + n;
+        if (!publisher_->enqueue(TextMessage::createCuePreload(CueList::cueId(i), cueList_.text(i),
+                                                               cueList_.textSize(i)))) {
+            break;
+        }
+        preloadQueued_ |= 1u << n;
+    }
+}
+
+void SenderApp::goCue() {
+    if (!publisher_ || standbyCue_ >= cueList_.size()) {
+        return;
+    }
+
+    // The receivers already hold the text - only the id and a hash to check it against go out
+    size_t index = standbyCue_;
+    std::string text = cueList_.text(index);
+    TextSize size = cueList_.textSize(index);
+    publisher_->enqueueGo(CueList::cueId(index), text, size);
+    textMemory_->recordText(text);
+
+    // The input shows what is on air, ready to be edited live
+    memset(textBuffer_, 0, sizeof(textBuffer_));
+    memcpy(textBuffer_, text.data(), std::min(text.size(), sizeof(textBuffer_) - 1));
+    previousTextBuffer_ = textBuffer_;
+    lastSentText_ = textBuffer_;
+    currentTextSize_ = size;
+    isFading_ = false;
+    fadeAlpha_ = 0.0f;
+    fadingText_.clear();
+
+    liveCue_ = index;
+    standbyCue_ = index + 1;
+    scrollToStandby_ = true;
+    preloadCues();
+}
+
 void SenderApp::sendText() {
     if (publisher_) {
         std::string text(textBuffer_);
         if (!text.empty()) {
             TextMessage message(text, currentTextSize_);
-            publisher_->publish(message);
+            publisher_->enqueue(message);
             lastSentText_ = text;
 
             // Record in text memory
@@ -794,26 +1017,26 @@ void SenderApp::sendCurrentText() {
     if (publisher_) {
         std::string text(textBuffer_);
 
-        std::cout << "SEND_DEBUG: text='" << text << "', lastSentText_='" << lastSentText_ << "'" << std::endl;
+        LT_LOG_DEBUG("SEND_DEBUG: text='%s', lastSentText_='%s'", text, lastSentText_);
 
         // Send the current text state (even if empty)
         if (!text.empty()) {
             TextMessage message(text, currentTextSize_);
-            publisher_->publish(message);
+            publisher_->enqueue(message);
             lastSentText_ = text;
             textMemory_->recordText(text);
-            std::cout << "SEND_DEBUG: Sent text message, updated lastSentText_='" << lastSentText_ << "'" << std::endl;
+            LT_LOG_DEBUG("SEND_DEBUG: Sent text message, updated lastSentText_='%s'", lastSentText_);
         } else {
             // Text is empty - send clear message
             if (!lastSentText_.empty()) {
                 // Send clear message
                 TextMessage clearMessage = TextMessage::createClearMessage();
-                publisher_->publish(clearMessage);
+                publisher_->enqueue(clearMessage);
                 textMemory_->onTextCleared();
-                std::cout << "SEND_DEBUG: Sent clear message, lastSentText_ remains='" << lastSentText_ << "'" << std::endl;
+                LT_LOG_DEBUG("SEND_DEBUG: Sent clear message, lastSentText_ remains='%s'", lastSentText_);
                 // Don't clear lastSentText_ here - let the fade-out logic handle it
             } else {
-                std::cout << "SEND_DEBUG: Text empty and lastSentText_ already empty - no action" << std::endl;
+                LT_LOG_DEBUG("SEND_DEBUG: Text empty and lastSentText_ already empty - no action");
             }
         }
     }
@@ -822,7 +1045,7 @@ void SenderApp::sendCurrentText() {
 void SenderApp::clearText() {
     if (publisher_) {
         TextMessage clearMessage = TextMessage::createClearMessage();
-        publisher_->publish(clearMessage);
+        publisher_->enqueue(clearMessage);
 
         // Record cleared text in memory
         textMemory_->onTextCleared();
@@ -847,6 +1070,25 @@ void SenderApp::switchTextSize(TextSize size) {
     sendText();
 }
 
+void SenderApp::recordFlip(const TextMessage& report) {
+    // A newer revision starts over; a straggler for an older one changes nothing
+    if (flipSkew_.peers.empty() || report.revision > flipSkew_.revision) {
+        flipSkew_ = FlipSkew();
+        flipSkew_.revision = report.revision;
+        flipSkew_.earliest = report.clockTime;
+        flipSkew_.latest = report.clockTime;
+        flipSkew_.worstLateUs = static_cast<int64_t>(report.clockTime - report.presentAt);
+    } else if (report.revision < flipSkew_.revision ||
+               std::find(flipSkew_.peers.begin(), flipSkew_.peers.end(), report.peerId) != flipSkew_.peers.end()) {
+        return;
+    }
+
+    flipSkew_.peers.push_back(report.peerId);
+    flipSkew_.earliest = std::min(flipSkew_.earliest, report.clockTime);
+    flipSkew_.latest = std::max(flipSkew_.latest, report.clockTime);
+    flipSkew_.worstLateUs = std::max(flipSkew_.worstLateUs, static_cast<int64_t>(report.clockTime - report.presentAt));
+}
+
 void SenderApp::setupDarkTheme() {
     ImGuiStyle& style = ImGui::GetStyle();
 
@@ -876,7 +1118,7 @@ void SenderApp::setupDarkTheme() {
 
 void SenderApp::updateHealthMonitoring() {
     if (publisher_) {
-        auto stats = publisher_->getStats();
+        auto stats = publisher_->getConnectionStats();
 
         for (size_t i = 0; i < stats.size(); ++i) {
             const auto& stat = stats[i];
@@ -895,6 +1137,44 @@ void SenderApp::updateHealthMonitoring() {
         bool publisherHealthy = publisher_->isHealthy();
         healthMonitor_->updateMetric("Publisher Health", publisherHealthy ? 1.0 : 0.0,
                                    publisherHealthy ? HealthStatus::HEALTHY : HealthStatus::CRITICAL);
+
+        // Queue between the UI and the publisher thread - a backlog means the network is slow, not the UI
+        publisher_->updateStats();
+        const PublishQueueStats& queue = publisher_->getStats();
+        char details[160];
+        snprintf(details, sizeof(details), "depth %zu (max %zu), %.2f ms avg, %.2f ms max, %llu retries, %llu failed, %llu rejected",
+                 queue.depth, queue.maxDepth, queue.avgLatencyMs, queue.maxLatencyMs,
+                 static_cast<unsigned long long>(queue.retries), static_cast<unsigned long long>(queue.failed),
+                 static_cast<unsigned long long>(queue.rejected));
+        bool backlogged = queue.maxLatencyMs > PUBLISH_LATENCY_WARNING_MS ||
+                          queue.maxDepth >= AsyncPublisher::QUEUE_CAPACITY / 2;
+        healthMonitor_->updateMetric("Publish Queue", queue.avgLatencyMs,
+                                   backlogged ? HealthStatus::WARNING : HealthStatus::HEALTHY, details);
+    }
+
+    // Video background - drops only mean the UI redraws slower than the source
+    if (videoSource_ && videoSource_->isActive()) {
+        const VideoCaptureStats& video = videoSource_->getStats();
+        char details[160];
+        snprintf(details, sizeof(details), "%s, captured %.1f fps, shown %.1f fps, dropped %.1f fps",
+                 videoSource_->getKind(), video.capturedFps, video.deliveredFps, video.droppedFps);
+        healthMonitor_->updateMetric("Video Capture", video.capturedFps,
+                                   (video.captured > 0 && video.capturedFps == 0.0) ? HealthStatus::WARNING : HealthStatus::HEALTHY,
+                                   details);
+    }
+
+    // UI thread time spent handing a frame to the GPU - should stay flat whatever the source resolution
+    if (videoUploader_ && videoUploader_->getStats().uploaded > 0) {
+        const VideoUploadStats& upload = videoUploader_->getStats();
+        char details[128];
+        snprintf(details, sizeof(details), "%.2f ms avg, %.2f ms max, %.0f MB/s, %dx%d %s, %llu deferred, PBOs %s",
+                 upload.avgUploadMs, upload.maxUploadMs, upload.uploadMBps,
+                 videoUploader_->getWidth(), videoUploader_->getHeight(),
+                 videoUploader_->getFormat() == VideoPixelFormat::UYVY ? "UYVY" : "BGRA",
+                 static_cast<unsigned long long>(upload.deferred), upload.persistent ? "persistent" : "per-frame map");
+        healthMonitor_->updateMetric("Video Upload", upload.avgUploadMs,
+                                   upload.maxUploadMs > VIDEO_UPLOAD_WARNING_MS ? HealthStatus::WARNING : HealthStatus::HEALTHY,
+                                   details);
     }
 }
 
@@ -906,6 +1186,9 @@ void SenderApp::renderKeyboardShortcuts() {
     ImGui::BulletText("Ctrl+1: Small text mode");
     ImGui::BulletText("Ctrl+2: Big text mode");
     ImGui::BulletText("F1: Toggle shortcuts help");
+    if (cueList_.isLoaded()) {
+        ImGui::BulletText("F5: GO - take the standby cue");
+    }
 }
 
 void SenderApp::handleKeyboardInput() {
@@ -928,6 +1211,11 @@ void SenderApp::handleKeyboardInput() {
     if (ImGui::IsKeyPressed(ImGuiKey_F1)) {
         showKeyboardShortcuts_ = !showKeyboardShortcuts_;
     }
+
+    // No repeat - holding the key must not run through the show
+    if (cueList_.isLoaded() && ImGui::IsKeyPressed(ImGuiKey_F5, false)) {
+        goCue();
+    }
 }
 
 void SenderApp::validateTextInput() {
@@ -998,78 +1286,117 @@ void SenderApp::updateFade() {
 }
 
 // ============================================================================
-// NDI Implementation
+// Frame Pacing
 // ============================================================================
 
-bool SenderApp::initializeNDI() {
-    std::cout << "Initializing NDI receiver..." << std::endl;
+void SenderApp::onInputEvent(GLFWwindow* window) {
+    SenderApp* app = static_cast<SenderApp*>(glfwGetWindowUserPointer(window));
+    if (app) {
+        app->lastInputTime_ = std::chrono::steady_clock::now();
+    }
+}
 
-    ndiReceiver_ = std::make_unique<NDIReceiver>();
+bool SenderApp::needsFullRate() const {
+    // ImGui needs a few frames after input to settle hover, focus and key-up state
+    double sinceInput = std::chrono::duration<double>(std::chrono::steady_clock::now() - lastInputTime_).count();
+    bool heldBack = publisher_ && publisher_->hasHeldBack();
+    return isFading_ || heldBack || sinceInput < ACTIVE_HOLD_SECONDS;
+}
 
-    if (!ndiReceiver_->initialize()) {
-        std::cerr << "Warning: Failed to initialize NDI. Video background disabled." << std::endl;
-        ndiReceiver_.reset();
-        return false;
+void SenderApp::updateFrameRates(bool idle, double frameSeconds) {
+    if (idle) {
+        idleFrames_++;
+        idleSeconds_ += frameSeconds;
+    } else {
+        activeFrames_++;
+        activeSeconds_ += frameSeconds;
     }
 
-    // Try to connect to first available NDI source
-    // Change "" to specific name like "Resolume" or "Arena" to filter
-    if (!ndiReceiver_->connect("")) {
-        std::cerr << "Warning: No NDI source found. Video background disabled." << std::endl;
-        ndiReceiver_.reset();
+    double total = activeSeconds_ + idleSeconds_;
+    if (total < 1.0) {
+        return;
+    }
+
+    activeFps_ = activeSeconds_ > 0.0 ? activeFrames_ / activeSeconds_ : 0.0;
+    idleFps_ = idleSeconds_ > 0.0 ? idleFrames_ / idleSeconds_ : 0.0;
+    idleShare_ = idleSeconds_ / total;
+    activeFrames_ = idleFrames_ = 0;
+    activeSeconds_ = idleSeconds_ = 0.0;
+}
+
+// ============================================================================
+// Video Background Implementation
+// ============================================================================
+
+bool SenderApp::initializeVideoSource() {
+    switch (config_.videoSource) {
+        case VideoSourceType::SYNTHETIC:
+            videoSource_ = std::make_unique<SyntheticVideoSource>(
+                config_.videoWidth, config_.videoHeight, config_.videoFps, config_.videoFormat);
+            break;
+        case VideoSourceType::FILE:
+            videoSource_ = std::make_unique<FileVideoSource>(
+                config_.videoFile, config_.videoWidth, config_.videoHeight, config_.videoFps, config_.videoFormat);
+            break;
+        case VideoSourceType::NDI: {
+            // Returns at once - the source is connected whenever discovery finds it
+            auto ndi = std::make_unique<NDIReceiver>(config_.ndiSource);
+            ndi->setPreferUYVY(config_.ndiUYVY);
+            ndiReceiver_ = ndi.get();
+            videoSource_ = std::move(ndi);
+            break;
+        }
+    }
+
+    // Each new frame wakes an idle UI loop, so the background keeps the source's rate
+    videoSource_->setFrameListener([]() { glfwPostEmptyEvent(); });
+
+    std::cout << "Starting " << videoSource_->getKind() << " video source..." << std::endl;
+    if (!videoSource_->start()) {
+        std::cerr << "Warning: " << videoSource_->getKind() << " video source unavailable. Video background disabled." << std::endl;
+        ndiReceiver_ = nullptr;
+        videoSource_.reset();
         return false;
     }
 
-    std::cout << "Connected to NDI source: " << ndiReceiver_->getSourceName() << std::endl;
+    std::cout << "Video source: " << videoSource_->getKind() << " - " << videoSource_->getName() << std::endl;
 
-    // Create OpenGL texture for NDI frames
-    glGenTextures(1, &ndiTexture_);
-    glBindTexture(GL_TEXTURE_2D, ndiTexture_);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    // Texture plus PBO ring for video frames - storage is sized on the first frame
+    videoUploader_ = std::make_unique<VideoTextureUploader>();
+    videoUploader_->initialize();
 
     return true;
 }
 
-void SenderApp::updateNDITexture() {
-    if (!ndiReceiver_ || !ndiReceiver_->isConnected()) {
+void SenderApp::updateVideoTexture() {
+    if (!videoSource_ || !videoSource_->isActive()) {
         return;
     }
 
-    // Capture latest NDI frame
-    NDIFrame* frame = ndiReceiver_->captureFrame();
-    if (!frame || !frame->data) {
+    videoSource_->updateStats();
+    videoUploader_->updateStats();
+
+    // Leave the frame with the capture thread until a PBO is free - the next look gets a newer one
+    if (!videoUploader_->canUpload()) {
         return;
     }
 
-    // Upload frame to OpenGL texture
-    glBindTexture(GL_TEXTURE_2D, ndiTexture_);
-
-    // Reallocate texture if size changed
-    if (frame->width != ndiTextureWidth_ || frame->height != ndiTextureHeight_) {
-        ndiTextureWidth_ = frame->width;
-        ndiTextureHeight_ = frame->height;
-        std::cout << "NDI frame size: " << ndiTextureWidth_ << "x" << ndiTextureHeight_ << std::endl;
+    // Newest frame from the capture thread - older ones were already skipped
+    const VideoFrame* frame = videoSource_->acquireLatestFrame();
+    if (!frame || !frame->data) {
+        return;
     }
 
-    // Upload BGRA data to texture
-    // NDI gives us BGRA, OpenGL expects BGRA with GL_BGRA format
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, frame->stride / 4); // 4 bytes per pixel (BGRA)
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, frame->width, frame->height,
-                 0, GL_BGRA, GL_UNSIGNED_BYTE, frame->data);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (frame->width != videoUploader_->getWidth() || frame->height != videoUploader_->getHeight()) {
+        std::cout << "Video frame size: " << frame->width << "x" << frame->height << std::endl;
+    }
 
-    // Release the frame back to NDI
-    ndiReceiver_->releaseFrame(frame);
+    // BGRA or UYVY; the uploader streams it through a PBO into the existing texture
+    videoUploader_->upload(*frame);
 }
 
-void SenderApp::renderNDIBackground(const ImVec2& pos, const ImVec2& size) {
-    if (!ndiTexture_ || ndiTextureWidth_ == 0 || ndiTextureHeight_ == 0) {
+void SenderApp::renderVideoBackground(const ImVec2& pos, const ImVec2& size) {
+    if (!videoUploader_ || videoUploader_->getWidth() == 0 || videoUploader_->getHeight() == 0) {
         return;
     }
 
@@ -1085,8 +1412,13 @@ void SenderApp::renderNDIBackground(const ImVec2& pos, const ImVec2& size) {
     float areaWidth = rectMax.x - rectMin.x;
     float areaHeight = rectMax.y - rectMin.y;
 
-    // Calculate aspect-fit for NDI video within input area (maintain aspect ratio, show full video)
-    float videoAspect = (float)ndiTextureWidth_ / (float)ndiTextureHeight_;
+    // Let the capture thread shrink frames to the pixels they actually cover on screen
+    ImVec2 framebufferScale = ImGui::GetIO().DisplayFramebufferScale;
+    videoSource_->setTargetSize(static_cast<int>(areaWidth * framebufferScale.x),
+                                static_cast<int>(areaHeight * framebufferScale.y));
+
+    // Calculate aspect-fit for the video within input area (maintain aspect ratio, show full video)
+    float videoAspect = (float)videoUploader_->getWidth() / (float)videoUploader_->getHeight();
     float areaAspect = areaWidth / areaHeight;
 
     float scaledWidth, scaledHeight;
@@ -1109,9 +1441,9 @@ void SenderApp::renderNDIBackground(const ImVec2& pos, const ImVec2& size) {
     ImVec2 videoMin = ImVec2(rectMin.x + offsetX, rectMin.y + offsetY);
     ImVec2 videoMax = ImVec2(rectMin.x + offsetX + scaledWidth, rectMin.y + offsetY + scaledHeight);
 
-    // Draw the NDI video texture centered and aspect-fitted
+    // Draw the video texture centered and aspect-fitted
     drawList->AddImage(
-        (ImTextureID)(intptr_t)ndiTexture_,
+        (ImTextureID)(intptr_t)videoUploader_->getTexture(),
         videoMin,
         videoMax,
         ImVec2(0, 0), // UV min
@@ -1120,15 +1452,16 @@ void SenderApp::renderNDIBackground(const ImVec2& pos, const ImVec2& size) {
     );
 }
 
-void SenderApp::shutdownNDI() {
-    if (ndiTexture_) {
-        glDeleteTextures(1, &ndiTexture_);
-        ndiTexture_ = 0;
+void SenderApp::shutdownVideoSource() {
+    if (videoUploader_) {
+        videoUploader_->shutdown();
+        videoUploader_.reset();
     }
 
-    if (ndiReceiver_) {
-        ndiReceiver_->shutdown();
-        ndiReceiver_.reset();
+    if (videoSource_) {
+        videoSource_->stop();
+        ndiReceiver_ = nullptr;
+        videoSource_.reset();
     }
 }
 
@@ -4,11 +4,19 @@
 #include <string>
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <vector>
 #include "common/AeronConnection.h"
 #include "common/HealthMonitor.h"
 #include "common/TextMessage.h"
+#include "AsyncPublisher.h"
+#include "CueList.h"
 #include "TextMemory.h"
+#include "OverlayTextLayout.h"
 #include "NDIReceiver.h"
+#include "VideoSource.h"
+#include "VideoTextureUploader.h"
+#include "SenderConfig.h"
 
 // Forward declarations for ImGui
 struct ImGuiInputTextCallbackData;
@@ -18,7 +26,7 @@ namespace LiveText {
 
 class SenderApp {
 public:
-    SenderApp();
+    explicit SenderApp(const SenderConfig& config = SenderConfig());
     ~SenderApp();
 
     bool initialize();
@@ -26,11 +34,30 @@ public:
     void shutdown();
 
 private:
+    SenderConfig config_;
+
     // GLFW and ImGui
     GLFWwindow* window_;
 
-    // Aeron communication
-    std::unique_ptr<DualAeronPublisher> publisher_;
+    // Aeron communication - sends happen on the publisher's own thread
+    std::unique_ptr<AsyncPublisher> publisher_;
+
+    // Receiver fit reports (written on the network thread)
+    std::unique_ptr<AeronSubscriber> feedbackSubscriber_;
+    std::mutex fitMutex_;
+    TextMessage lastFitReport_;
+    bool hasFitReport_;
+
+    // Receivers' PRESENT_REPORTs for the newest revision - how far apart the screens flipped
+    struct FlipSkew {
+        uint32_t revision = 0;
+        std::vector<uint32_t> peers;    // Receivers that reported it
+        uint64_t earliest = 0;          // Sender clock, us
+        uint64_t latest = 0;
+        int64_t worstLateUs = 0;        // Furthest past the presentation time
+    };
+    std::mutex skewMutex_;
+    FlipSkew flipSkew_;
 
     // Health monitoring
     std::unique_ptr<HealthMonitor> healthMonitor_;
@@ -38,11 +65,20 @@ private:
     // Text memory
     std::unique_ptr<TextMemory> textMemory_;
 
-    // NDI video receiver
-    std::unique_ptr<NDIReceiver> ndiReceiver_;
-    GLuint ndiTexture_;
-    int ndiTextureWidth_;
-    int ndiTextureHeight_;
+    // Show file cues. The standby cue and the next few are preloaded on the
+    // receivers, so GO sends only a cue id and the cut is a single frame.
+    CueList cueList_;
+    size_t standbyCue_;         // Taken by the next GO
+    size_t liveCue_;            // Last cue taken, SIZE_MAX if none
+    size_t preloadedFrom_;      // First cue of the preload window, SIZE_MAX if none yet
+    uint32_t preloadQueued_;    // Bit n: cue preloadedFrom_ + n has been queued
+    std::chrono::steady_clock::time_point lastPreload_;
+    bool scrollToStandby_;
+
+    // Background video (NDI, synthetic or file)
+    std::unique_ptr<VideoSource> videoSource_;
+    std::unique_ptr<VideoTextureUploader> videoUploader_;
+    NDIReceiver* ndiReceiver_;      // videoSource_ when it is NDI - for the source picker
 
     // UI state
     char textBuffer_[512];
@@ -65,19 +101,36 @@ private:
     int selectionStart_;
     int selectionEnd_;
 
+    // Centered overlay layouts - re-measured only when their text, font or widget size changes
+    OverlayTextLayout inputLayout_;
+    OverlayTextLayout fadeLayout_;
+
     // Fade out animation state
     bool isFading_;
     float fadeAlpha_;
     std::chrono::steady_clock::time_point fadeStartTime_;
     std::string fadingText_;
 
+    // Frame pacing: full rate while the user is interacting or a fade runs,
+    // otherwise wait for events (input, a new video frame, a fit report)
+    std::chrono::steady_clock::time_point lastInputTime_;
+    std::chrono::steady_clock::time_point lastHealthUpdate_;
+    uint64_t activeFrames_;
+    uint64_t idleFrames_;
+    double activeSeconds_;
+    double idleSeconds_;
+    double activeFps_;
+    double idleFps_;
+    double idleShare_;      // Fraction of wall time spent in idle frames
 
     // UI methods
     void renderMainWindow();
     void renderTextInput();
     void renderControlButtons();
+    void renderFitStatus();
     void renderHealthStatus();
     void renderTextMemory();
+    void renderCueList();
     void renderConnectionStatus();
     void renderKeyboardShortcuts();
     void handleKeyboardInput();
@@ -94,17 +147,26 @@ private:
     void sendCurrentText();
     void clearText();
     void switchTextSize(TextSize size);
+    void recordFlip(const TextMessage& report);
+    void setStandbyCue(size_t index);
+    void preloadCues();
+    void goCue();
 
     // Style methods
     void setupDarkTheme();
     void updateHealthMonitoring();
     void updateFade();
 
-    // NDI methods
-    bool initializeNDI();
-    void updateNDITexture();
-    void renderNDIBackground(const ImVec2& pos, const ImVec2& size);
-    void shutdownNDI();
+    // Frame pacing methods
+    bool needsFullRate() const;
+    void updateFrameRates(bool idle, double frameSeconds);
+    static void onInputEvent(GLFWwindow* window);
+
+    // Video background methods
+    bool initializeVideoSource();
+    void updateVideoTexture();
+    void renderVideoBackground(const ImVec2& pos, const ImVec2& size);
+    void shutdownVideoSource();
 
     // Configuration
     static constexpr int WINDOW_WIDTH = 1200;
@@ -112,11 +174,21 @@ private:
     static constexpr float SMALL_TEXT_SIZE = 18.0f;
     static constexpr float BIG_TEXT_SIZE = 64.0f;
     static constexpr float FADE_DURATION_SECONDS = 2.0f;
+    static constexpr double VIDEO_UPLOAD_WARNING_MS = 4.0;   // A quarter of a 60 Hz UI frame
+    static constexpr double IDLE_WAIT_SECONDS = 0.25;        // Longest idle sleep - keeps the caret blinking and clocks moving
+    static constexpr double ACTIVE_HOLD_SECONDS = 0.5;       // Full rate this long after the last input
+    static constexpr double HEALTH_UPDATE_SECONDS = 0.25;
+    static constexpr double PUBLISH_LATENCY_WARNING_MS = 5.0;  // Enqueue to wire
+    static constexpr size_t CUE_PRELOAD_COUNT = 3;           // Standby and the two after - receivers stage one more (the live cue)
+    static constexpr double CUE_PRELOAD_RESEND_SECONDS = 5.0; // Again for receivers that joined since
+    static_assert(CUE_PRELOAD_COUNT < 32, "preloadQueued_ has a bit per preloaded cue");
 
     // Aeron configuration - using localhost unicast instead of multicast
     static constexpr const char* PRIMARY_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9999";
     static constexpr const char* SECONDARY_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9998";
     static constexpr int STREAM_ID = 1001;
+    static constexpr const char* FEEDBACK_CHANNEL = "aeron:udp?endpoint=127.0.0.1:9997";
+    static constexpr int FEEDBACK_STREAM_ID = 1002;
 };
 
 } // namespace LiveText
\ No newline at end of file
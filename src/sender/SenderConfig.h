@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include "VideoFrame.h"
+
+namespace LiveText {
+
+enum class VideoSourceType {
+    NDI,
+    SYNTHETIC,
+    FILE
+};
+
+struct SenderConfig {
+    bool ndiUYVY = false;       // Receive NDI as UYVY and convert on the GPU instead of in the SDK
+    std::string ndiSource;      // Part of the NDI source name to connect to (empty = first available)
+
+    // Background video. Synthetic and file sources use the size, rate and format below.
+    VideoSourceType videoSource = VideoSourceType::NDI;
+    std::string videoFile;      // Raw frames for VideoSourceType::FILE
+    int videoWidth = 1920;
+    int videoHeight = 1080;
+    double videoFps = 60.0;     // <= 0 runs the synthetic source unpaced
+    VideoPixelFormat videoFormat = VideoPixelFormat::BGRA;
+
+    // Periodic state refreshes carry only revision, size and hash unless this is set;
+    // receivers then ask for the text over the feedback channel when theirs differs
+    bool refreshWithText = false;
+
+    // Updates are stamped to go up this long after they are sent, so every receiver
+    // that has synced its clock to the sender flips on the same frame (0 = on arrival)
+    int presentationDelayMs = 40;
+
+    // Show file for the cue list (empty = no cue list, live typing only)
+    std::string showFile;
+};
+
+} // namespace LiveText
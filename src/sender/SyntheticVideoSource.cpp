@@ -0,0 +1,116 @@
+#include "SyntheticVideoSource.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace LiveText {
+
+namespace {
+
+// 75% colour bars, BGR
+const uint8_t BARS[8][3] = {
+    {191, 191, 191}, {0, 191, 191}, {191, 191, 0}, {0, 191, 0},
+    {191, 0, 191}, {0, 0, 191}, {191, 0, 0}, {0, 0, 0}
+};
+
+uint8_t clampByte(double value) {
+    return static_cast<uint8_t>(std::lround(std::min(255.0, std::max(0.0, value))));
+}
+
+} // namespace
+
+SyntheticVideoSource::SyntheticVideoSource(int width, int height, double fps, VideoPixelFormat format)
+    : width_(std::max(2, width & ~1))
+    , height_(std::max(1, height))
+    , fps_(fps)
+    , format_(format)
+    , patternStride_(0)
+    , scrollPerFrame_(2)
+    , frameIndex_(0)
+{
+}
+
+SyntheticVideoSource::~SyntheticVideoSource() {
+    stop();
+}
+
+bool SyntheticVideoSource::start() {
+    renderPattern();
+
+    // One full pattern width every four seconds at the nominal rate
+    double framesPerCycle = (fps_ > 0.0 ? fps_ : 60.0) * 4.0;
+    scrollPerFrame_ = std::max(2, static_cast<int>(width_ / framesPerCycle) & ~1);
+    frameIndex_ = 0;
+
+    startCapture("synthetic");
+    std::cout << "Synthetic video source: " << getName() << std::endl;
+    return true;
+}
+
+void SyntheticVideoSource::stop() {
+    stopCapture();
+}
+
+std::string SyntheticVideoSource::getName() const {
+    std::ostringstream name;
+    name << width_ << "x" << height_ << " " << (format_ == VideoPixelFormat::UYVY ? "UYVY" : "BGRA");
+    if (fps_ > 0.0) {
+        name << " @ " << fps_ << " fps";
+    } else {
+        name << " unpaced";
+    }
+    return name.str();
+}
+
+void SyntheticVideoSource::renderPattern() {
+    const int patternWidth = width_ * 2;
+    patternStride_ = patternWidth * bytesPerPixel(format_);
+    pattern_.assign(static_cast<size_t>(patternStride_) * height_, 0);
+
+    // BT.709 (HD) or BT.601 (SD) studio range, matching the uploader's conversion back to RGB
+    bool hd = height_ >= 720;
+    const double kr = hd ? 0.2126 : 0.299;
+    const double kb = hd ? 0.0722 : 0.114;
+
+    for (int y = 0; y < height_; ++y) {
+        // Vertical ramp so downscaling has detail in both directions
+        double shade = 0.35 + 0.65 * (1.0 - static_cast<double>(y) / height_);
+        uint8_t* row = pattern_.data() + static_cast<size_t>(y) * patternStride_;
+
+        for (int x = 0; x < patternWidth; ++x) {
+            const uint8_t* bar = BARS[((x % width_) * 8) / width_];
+            double b = bar[0] * shade, g = bar[1] * shade, r = bar[2] * shade;
+
+            if (format_ == VideoPixelFormat::BGRA) {
+                uint8_t* pixel = row + x * 4;
+                pixel[0] = clampByte(b);
+                pixel[1] = clampByte(g);
+                pixel[2] = clampByte(r);
+                pixel[3] = 255;
+            } else {
+                double luma = kr * r + (1.0 - kr - kb) * g + kb * b;
+                uint8_t* pair = row + (x / 2) * 4;
+                pair[(x & 1) ? 3 : 1] = clampByte(16.0 + luma * 219.0 / 255.0);
+                if ((x & 1) == 0) {
+                    // 4:2:2 - the left pixel of each pair supplies the shared chroma
+                    pair[0] = clampByte(128.0 + (b - luma) / (2.0 * (1.0 - kb)) * 224.0 / 255.0);
+                    pair[2] = clampByte(128.0 + (r - luma) / (2.0 * (1.0 - kr)) * 224.0 / 255.0);
+                }
+            }
+        }
+    }
+}
+
+void SyntheticVideoSource::captureNext() {
+    if (!waitForNextFrame(fps_)) {
+        return;
+    }
+
+    int offset = static_cast<int>((frameIndex_ * scrollPerFrame_) % width_) & ~1;
+    const uint8_t* window = pattern_.data() + static_cast<size_t>(offset) * bytesPerPixel(format_);
+    deliverFrame(window, width_, height_, patternStride_, format_, frameIndex_);
+    frameIndex_++;
+}
+
+} // namespace LiveText
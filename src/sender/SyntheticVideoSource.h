@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "VideoSource.h"
+
+namespace LiveText {
+
+// Scrolling colour-bar test pattern at a fixed resolution and frame rate.
+//
+// The pattern is rendered once into a buffer twice the frame width, and each
+// frame is a window into it at a moving offset - so producing a frame costs
+// nothing and the capture thread's copy, downscale and the upload are all
+// that is measured. fps <= 0 delivers frames as fast as they are taken.
+class SyntheticVideoSource : public VideoSource {
+public:
+    SyntheticVideoSource(int width, int height, double fps, VideoPixelFormat format);
+    ~SyntheticVideoSource() override;
+
+    bool start() override;
+    void stop() override;
+    bool isActive() const override { return isCapturing(); }
+    const char* getKind() const override { return "Synthetic"; }
+    std::string getName() const override;
+
+private:
+    int width_, height_;
+    double fps_;
+    VideoPixelFormat format_;
+    std::vector<uint8_t> pattern_;  // 2 * width_ pixels per row
+    int patternStride_;
+    int scrollPerFrame_;            // Pixels, even so UYVY stays on macropixel boundaries
+    uint64_t frameIndex_;
+
+    void renderPattern();
+    void captureNext() override;
+};
+
+} // namespace LiveText
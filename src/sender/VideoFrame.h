@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+
+namespace LiveText {
+
+enum class VideoPixelFormat {
+    BGRA,   // 4 bytes per pixel
+    UYVY    // 4:2:2, 2 bytes per pixel - U Y0 V Y1 per pixel pair, converted on the GPU
+};
+
+inline int bytesPerPixel(VideoPixelFormat format) {
+    return format == VideoPixelFormat::UYVY ? 2 : 4;
+}
+
+struct VideoFrame {
+    const uint8_t* data;
+    VideoPixelFormat format;
+    int width;
+    int height;
+    int stride;
+    uint64_t timestamp;
+};
+
+} // namespace LiveText
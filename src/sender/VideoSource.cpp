@@ -0,0 +1,157 @@
+#include "VideoSource.h"
+#include "FrameDownscaler.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace LiveText {
+
+VideoSource::VideoSource()
+    : capturing_(false)
+    , framesCaptured_(0)
+    , framesDropped_(0)
+    , framesDelivered_(0)
+    , nextFrameTime_(std::chrono::steady_clock::now())
+    , targetWidth_(0)
+    , targetHeight_(0)
+    , sourceWidth_(0)
+    , sourceHeight_(0)
+    , downscaleFactor_(1)
+    , downscaleMicros_(0)
+    , lastStatsUpdate_(std::chrono::steady_clock::now())
+    , downscaleMicrosAtLastUpdate_(0)
+{
+    memset(&currentFrame_, 0, sizeof(currentFrame_));
+}
+
+VideoSource::~VideoSource() {
+    // Derived classes should have stopped already; this only catches a missed join
+    stopCapture();
+}
+
+void VideoSource::setTargetSize(int width, int height) {
+    targetWidth_.store(width, std::memory_order_relaxed);
+    targetHeight_.store(height, std::memory_order_relaxed);
+}
+
+const VideoFrame* VideoSource::acquireLatestFrame() {
+    if (!frames_.update()) {
+        return nullptr;
+    }
+
+    const CapturedFrame& frame = frames_.read();
+    currentFrame_.data = frame.pixels.data();
+    currentFrame_.format = frame.format;
+    currentFrame_.width = frame.width;
+    currentFrame_.height = frame.height;
+    currentFrame_.stride = frame.width * bytesPerPixel(frame.format);
+    currentFrame_.timestamp = frame.timestamp;
+    framesDelivered_++;
+    return &currentFrame_;
+}
+
+void VideoSource::updateStats() {
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - lastStatsUpdate_).count();
+
+    stats_.captured = framesCaptured_.load(std::memory_order_relaxed);
+    stats_.dropped = framesDropped_.load(std::memory_order_relaxed);
+    stats_.delivered = framesDelivered_;
+    stats_.sourceWidth = sourceWidth_.load(std::memory_order_relaxed);
+    stats_.sourceHeight = sourceHeight_.load(std::memory_order_relaxed);
+    stats_.downscaleFactor = downscaleFactor_.load(std::memory_order_relaxed);
+    stats_.downscaleKernel = FrameDownscaler::kernelName(FrameDownscaler::bestKernel());
+    if (seconds < 1.0) {
+        return;
+    }
+
+    uint64_t downscaleMicros = downscaleMicros_.load(std::memory_order_relaxed);
+    uint64_t capturedInWindow = stats_.captured - statsAtLastUpdate_.captured;
+    stats_.downscaleMs = capturedInWindow > 0
+        ? (downscaleMicros - downscaleMicrosAtLastUpdate_) / 1000.0 / capturedInWindow : 0.0;
+    downscaleMicrosAtLastUpdate_ = downscaleMicros;
+
+    stats_.capturedFps = (stats_.captured - statsAtLastUpdate_.captured) / seconds;
+    stats_.droppedFps = (stats_.dropped - statsAtLastUpdate_.dropped) / seconds;
+    stats_.deliveredFps = (stats_.delivered - statsAtLastUpdate_.delivered) / seconds;
+    statsAtLastUpdate_ = stats_;
+    lastStatsUpdate_ = now;
+}
+
+void VideoSource::startCapture(const char* threadName) {
+    stopCapture();
+    threadName_ = threadName;
+    capturing_ = true;
+    captureThread_ = std::thread(&VideoSource::captureLoop, this);
+}
+
+void VideoSource::stopCapture() {
+    capturing_ = false;
+    if (captureThread_.joinable()) {
+        captureThread_.join();
+    }
+}
+
+void VideoSource::captureLoop() {
+    Logger::instance().setThreadName(threadName_.c_str());
+    nextFrameTime_ = std::chrono::steady_clock::now();
+    while (capturing_) {
+        captureNext();
+    }
+}
+
+bool VideoSource::waitForNextFrame(double fps) {
+    if (fps <= 0.0) {
+        return true;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now < nextFrameTime_) {
+        std::this_thread::sleep_until(std::min(nextFrameTime_, now + std::chrono::milliseconds(CAPTURE_TIMEOUT_MS)));
+        if (std::chrono::steady_clock::now() < nextFrameTime_) {
+            return false;
+        }
+    }
+
+    // Fixed cadence; after a stall (more than a frame late) restart from now instead of bursting
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / fps));
+    nextFrameTime_ += period;
+    if (nextFrameTime_ < std::chrono::steady_clock::now()) {
+        nextFrameTime_ = std::chrono::steady_clock::now() + period;
+    }
+    return true;
+}
+
+void VideoSource::deliverFrame(const uint8_t* data, int width, int height, int stride,
+                               VideoPixelFormat format, uint64_t timestamp) {
+    static const DownscaleKernel kernel = FrameDownscaler::bestKernel();
+
+    // Copy out downscaled to the drawn size - the caller releases its buffer as soon as this returns
+    CapturedFrame& frame = frames_.writeBuffer();
+    int factor = FrameDownscaler::chooseFactor(width, height,
+                                               targetWidth_.load(std::memory_order_relaxed),
+                                               targetHeight_.load(std::memory_order_relaxed));
+    auto copyStart = std::chrono::steady_clock::now();
+    FrameDownscaler::downscale(data, width, height, stride, format, factor, kernel,
+                               frame.pixels, downscaleScratch_, frame.width, frame.height);
+    auto copyMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - copyStart).count();
+    frame.format = format;
+    frame.timestamp = timestamp;
+
+    sourceWidth_.store(width, std::memory_order_relaxed);
+    sourceHeight_.store(height, std::memory_order_relaxed);
+    downscaleFactor_.store(factor, std::memory_order_relaxed);
+    downscaleMicros_.fetch_add(static_cast<uint64_t>(copyMicros), std::memory_order_relaxed);
+
+    framesCaptured_.fetch_add(1, std::memory_order_relaxed);
+    if (frames_.publish()) {
+        framesDropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (frameListener_) {
+        frameListener_();
+    }
+}
+
+} // namespace LiveText
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/TripleBuffer.h"
+#include "VideoFrame.h"
+
+namespace LiveText {
+
+struct VideoCaptureStats {
+    uint64_t captured = 0;      // Frames taken from the source (and released straight away)
+    uint64_t dropped = 0;       // Replaced by a newer frame before the UI took them
+    uint64_t delivered = 0;     // Handed to the UI
+    double capturedFps = 0.0;
+    double droppedFps = 0.0;
+    double deliveredFps = 0.0;
+    int sourceWidth = 0;        // As produced by the source, before downscaling
+    int sourceHeight = 0;
+    int downscaleFactor = 1;    // Per axis, on the capture thread
+    double downscaleMs = 0.0;   // Average copy-and-downscale time per captured frame
+    const char* downscaleKernel = "";
+};
+
+// A background video feed for the sender.
+//
+// Each source runs its own capture thread, which calls captureNext() in a
+// loop; the source hands every frame to deliverFrame(), which copies it
+// (box-downscaled to the drawn size) into a triple buffer and returns, so the
+// source's own buffer can be released at once. The UI thread takes the newest
+// frame with acquireLatestFrame() and never blocks on the source.
+//
+// Derived classes must call stopCapture() in stop() and in their destructor,
+// before any state captureNext() uses is torn down.
+class VideoSource {
+public:
+    VideoSource();
+    virtual ~VideoSource();
+
+    VideoSource(const VideoSource&) = delete;
+    VideoSource& operator=(const VideoSource&) = delete;
+
+    // Open the source and start capturing
+    virtual bool start() = 0;
+    virtual void stop() = 0;
+
+    virtual bool isActive() const = 0;
+    virtual const char* getKind() const = 0;
+    virtual std::string getName() const = 0;
+
+    // Pixel size the frames are drawn at. The capture thread box-downscales by
+    // 2x or 4x per axis while that still leaves at least this many pixels (0 = never).
+    void setTargetSize(int width, int height);
+
+    // Newest frame from the capture thread (non-blocking), or nullptr if there
+    // is nothing new. The pixels stay valid until the next call.
+    const VideoFrame* acquireLatestFrame();
+
+    // Called on the capture thread after each frame is handed off, e.g. to wake
+    // an idle UI loop. Set before start().
+    void setFrameListener(std::function<void()> listener) { frameListener_ = std::move(listener); }
+
+    // UI thread: refresh the per-second rates, at most once a second
+    void updateStats();
+    const VideoCaptureStats& getStats() const { return stats_; }
+
+protected:
+    static constexpr int CAPTURE_TIMEOUT_MS = 100;  // Longest captureNext() should block - bounds stopCapture()
+
+    // Capture thread: wait for (at most CAPTURE_TIMEOUT_MS) and deliver one frame
+    virtual void captureNext() = 0;
+
+    // Capture thread: copy a frame into the handoff. data may be released on return.
+    void deliverFrame(const uint8_t* data, int width, int height, int stride,
+                      VideoPixelFormat format, uint64_t timestamp);
+
+    void startCapture(const char* threadName);
+    void stopCapture();
+    bool isCapturing() const { return capturing_; }
+
+    // Capture thread: sleep towards the next frame time at fps (for at most
+    // CAPTURE_TIMEOUT_MS) and return true once it is due. fps <= 0 never waits.
+    bool waitForNextFrame(double fps);
+
+private:
+    struct CapturedFrame {
+        std::vector<uint8_t> pixels;    // Tightly packed rows in the frame's format
+        VideoPixelFormat format = VideoPixelFormat::BGRA;
+        int width = 0;
+        int height = 0;
+        uint64_t timestamp = 0;
+    };
+    std::thread captureThread_;
+    std::atomic<bool> capturing_;
+    std::string threadName_;
+    std::function<void()> frameListener_;
+    TripleBuffer<CapturedFrame> frames_;
+    std::atomic<uint64_t> framesCaptured_;
+    std::atomic<uint64_t> framesDropped_;
+    uint64_t framesDelivered_;      // UI thread only
+    std::chrono::steady_clock::time_point nextFrameTime_;  // Capture thread only
+
+    // Downscaling on the capture thread
+    std::atomic<int> targetWidth_;
+    std::atomic<int> targetHeight_;
+    std::atomic<int> sourceWidth_;
+    std::atomic<int> sourceHeight_;
+    std::atomic<int> downscaleFactor_;
+    std::atomic<uint64_t> downscaleMicros_;     // Running total, averaged per window in updateStats
+    std::vector<uint8_t> downscaleScratch_;     // Capture thread only
+
+    // Frame handed out by acquireLatestFrame
+    VideoFrame currentFrame_;
+
+    // Rates
+    VideoCaptureStats stats_;
+    VideoCaptureStats statsAtLastUpdate_;
+    std::chrono::steady_clock::time_point lastStatsUpdate_;
+    uint64_t downscaleMicrosAtLastUpdate_;
+
+    void captureLoop();
+};
+
+} // namespace LiveText
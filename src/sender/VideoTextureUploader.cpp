@@ -0,0 +1,370 @@
+#include "VideoTextureUploader.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace LiveText {
+
+VideoTextureUploader::VideoTextureUploader()
+    : texture_(0)
+    , width_(0)
+    , height_(0)
+    , stride_(0)
+    , format_(VideoPixelFormat::BGRA)
+    , frameBytes_(0)
+    , persistentSupported_(false)
+    , nextSlot_(0)
+    , packedTexture_(0)
+    , convertFramebuffer_(0)
+    , convertProgram_(0)
+    , convertVao_(0)
+    , coefficientsLocation_(-1)
+    , windowUploadMs_(0.0)
+    , windowMaxMs_(0.0)
+    , windowBytes_(0)
+    , windowUploads_(0)
+    , windowStart_(std::chrono::steady_clock::now())
+{
+}
+
+VideoTextureUploader::~VideoTextureUploader() {
+    shutdown();
+}
+
+bool VideoTextureUploader::initialize() {
+    if (texture_) {
+        return true;
+    }
+
+#ifdef GL_VERSION_4_4
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    persistentSupported_ = major > 4 || (major == 4 && minor >= 4);
+#endif
+    stats_.persistent = persistentSupported_;
+
+    glGenTextures(1, &texture_);
+    glBindTexture(GL_TEXTURE_2D, texture_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    std::cout << "Video texture upload: " << PBO_COUNT << " PBOs, "
+              << (persistentSupported_ ? "persistently mapped" : "mapped per frame") << std::endl;
+    return true;
+}
+
+void VideoTextureUploader::shutdown() {
+    releaseBuffers();
+    if (packedTexture_) {
+        glDeleteTextures(1, &packedTexture_);
+        packedTexture_ = 0;
+    }
+    if (convertFramebuffer_) {
+        glDeleteFramebuffers(1, &convertFramebuffer_);
+        convertFramebuffer_ = 0;
+    }
+    if (convertVao_) {
+        glDeleteVertexArrays(1, &convertVao_);
+        convertVao_ = 0;
+    }
+    if (convertProgram_) {
+        glDeleteProgram(convertProgram_);
+        convertProgram_ = 0;
+    }
+    if (texture_) {
+        glDeleteTextures(1, &texture_);
+        texture_ = 0;
+    }
+    width_ = height_ = 0;
+}
+
+void VideoTextureUploader::releaseBuffers() {
+    for (Slot& slot : slots_) {
+        if (slot.fence) {
+            glDeleteSync(slot.fence);
+        }
+        if (slot.mapped) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        if (slot.pbo) {
+            glDeleteBuffers(1, &slot.pbo);
+        }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    slots_.clear();
+    nextSlot_ = 0;
+}
+
+bool VideoTextureUploader::allocate(const VideoFrame& frame) {
+    releaseBuffers();
+
+    if (frame.format == VideoPixelFormat::UYVY && !createConvertPass()) {
+        return false;
+    }
+
+    // Storage is created here and nowhere else - every frame after this is a sub-image update
+    glBindTexture(GL_TEXTURE_2D, texture_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, frame.width, frame.height, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+    if (frame.format == VideoPixelFormat::UYVY) {
+        glBindTexture(GL_TEXTURE_2D, packedTexture_);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, frame.width / 2, frame.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, convertFramebuffer_);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_, 0);
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "Video conversion framebuffer incomplete: 0x" << std::hex << status << std::dec << std::endl;
+            glBindTexture(GL_TEXTURE_2D, 0);
+            return false;
+        }
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    frameBytes_ = static_cast<size_t>(frame.stride) * frame.height;
+    slots_.resize(PBO_COUNT);
+    for (Slot& slot : slots_) {
+        glGenBuffers(1, &slot.pbo);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+#ifdef GL_VERSION_4_4
+        if (persistentSupported_) {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, frameBytes_, nullptr, flags);
+            slot.mapped = static_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, frameBytes_, flags));
+            if (!slot.mapped) {
+                std::cerr << "Failed to map video upload buffer" << std::endl;
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                releaseBuffers();
+                return false;
+            }
+            continue;
+        }
+#endif
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, frameBytes_, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    width_ = frame.width;
+    height_ = frame.height;
+    stride_ = frame.stride;
+    format_ = frame.format;
+    stats_.reallocations++;
+    LT_LOG_INFO("Video texture allocated at %dx%d %s (%zu KB per PBO)", width_, height_,
+                format_ == VideoPixelFormat::UYVY ? "UYVY" : "BGRA", frameBytes_ / 1024);
+    return true;
+}
+
+bool VideoTextureUploader::canUpload() {
+    if (!texture_) {
+        return false;
+    }
+    if (slots_.empty()) {
+        return true;    // First frame allocates
+    }
+
+    Slot& slot = slots_[nextSlot_];
+    if (slot.fence) {
+        // Zero timeout: the GPU is still reading this PBO, try again next UI frame
+        GLenum result = glClientWaitSync(slot.fence, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+            stats_.deferred++;
+            return false;
+        }
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+    }
+    return true;
+}
+
+bool VideoTextureUploader::upload(const VideoFrame& frame) {
+    if (!frame.data || frame.width <= 0 || frame.height <= 0) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (frame.width != width_ || frame.height != height_ || frame.stride != stride_ || frame.format != format_) {
+        if (!allocate(frame)) {
+            return false;
+        }
+    }
+
+    Slot& slot = slots_[nextSlot_];
+    if (slot.fence) {
+        return false;   // canUpload() was not called, or said no
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+    if (slot.mapped) {
+        memcpy(slot.mapped, frame.data, frameBytes_);
+    } else {
+        // Unsynchronized is safe: the fence on this PBO has already signalled
+        void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, frameBytes_,
+                                        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (!mapped) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return false;
+        }
+        memcpy(mapped, frame.data, frameBytes_);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    // Sourced from the bound PBO - returns as soon as the copy is queued.
+    // UYVY goes in as RGBA texels of two pixels each and is converted below.
+    bool uyvy = frame.format == VideoPixelFormat::UYVY;
+    glBindTexture(GL_TEXTURE_2D, uyvy ? packedTexture_ : texture_);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, frame.stride / 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, uyvy ? frame.width / 2 : frame.width, frame.height,
+                    uyvy ? GL_RGBA : GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    nextSlot_ = (nextSlot_ + 1) % slots_.size();
+
+    if (uyvy) {
+        convert();
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats_.uploaded++;
+    windowUploadMs_ += ms;
+    windowMaxMs_ = std::max(windowMaxMs_, ms);
+    windowBytes_ += frameBytes_;
+    windowUploads_++;
+    return true;
+}
+
+void VideoTextureUploader::updateStats() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - windowStart_).count();
+    if (elapsed < 1.0) {
+        return;
+    }
+
+    stats_.avgUploadMs = windowUploads_ > 0 ? windowUploadMs_ / windowUploads_ : 0.0;
+    stats_.maxUploadMs = windowMaxMs_;
+    stats_.uploadMBps = (windowBytes_ / (1024.0 * 1024.0)) / elapsed;
+    windowUploadMs_ = 0.0;
+    windowMaxMs_ = 0.0;
+    windowBytes_ = 0;
+    windowUploads_ = 0;
+    windowStart_ = now;
+}
+
+void VideoTextureUploader::convert() {
+    // BT.709 for HD, BT.601 for SD - the matrices the SDK uses for its own BGRA conversion
+    bool hd = height_ >= 720;
+    const float rv = hd ? 1.5748f : 1.402f;
+    const float gu = hd ? 0.1873f : 0.344136f;
+    const float gv = hd ? 0.4681f : 0.714136f;
+    const float bu = hd ? 1.8556f : 1.772f;
+
+    // Leave the state as we found it - this runs outside ImGui's render pass
+    GLint previousFramebuffer = 0, previousProgram = 0, previousVao = 0, previousTexture = 0;
+    GLint previousViewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousVao);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+    GLboolean blend = glIsEnabled(GL_BLEND);
+    GLboolean scissor = glIsEnabled(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_SCISSOR_TEST);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, convertFramebuffer_);
+    glViewport(0, 0, width_, height_);
+    glUseProgram(convertProgram_);
+    glUniform4f(coefficientsLocation_, rv, gu, gv, bu);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, packedTexture_);
+    glBindVertexArray(convertVao_);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glBindVertexArray(previousVao);
+    glBindTexture(GL_TEXTURE_2D, previousTexture);
+    glUseProgram(previousProgram);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+    if (blend) glEnable(GL_BLEND);
+    if (scissor) glEnable(GL_SCISSOR_TEST);
+}
+
+bool VideoTextureUploader::createConvertPass() {
+    if (convertProgram_) {
+        return true;
+    }
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, CONVERT_VERTEX_SHADER);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, CONVERT_FRAGMENT_SHADER);
+    if (vertexShader == 0 || fragmentShader == 0) {
+        if (vertexShader) glDeleteShader(vertexShader);
+        if (fragmentShader) glDeleteShader(fragmentShader);
+        return false;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        GLchar infoLog[512];
+        glGetProgramInfoLog(program, 512, nullptr, infoLog);
+        std::cerr << "Video conversion shader linking error: " << infoLog << std::endl;
+        glDeleteProgram(program);
+        return false;
+    }
+
+    convertProgram_ = program;
+    coefficientsLocation_ = glGetUniformLocation(convertProgram_, "coefficients");
+    GLint previousProgram = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+    glUseProgram(convertProgram_);
+    glUniform1i(glGetUniformLocation(convertProgram_, "source"), 0);
+    glUseProgram(previousProgram);
+
+    glGenTextures(1, &packedTexture_);
+    glBindTexture(GL_TEXTURE_2D, packedTexture_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &convertFramebuffer_);
+    glGenVertexArrays(1, &convertVao_);   // Core profile needs one bound even with no attributes
+    return true;
+}
+
+GLuint VideoTextureUploader::compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        GLchar infoLog[512];
+        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+        std::cerr << "Video conversion shader compilation error: " << infoLog << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+} // namespace LiveText
@@ -0,0 +1,134 @@
+#pragma once
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION
+#endif
+#include <OpenGL/gl.h>
+#include <OpenGL/gl3.h>
+#else
+#include <GL/gl3w.h>
+#endif
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "VideoFrame.h"
+
+namespace LiveText {
+
+struct VideoUploadStats {
+    uint64_t uploaded = 0;
+    uint64_t deferred = 0;          // No PBO free yet - frame left for a later UI frame
+    uint64_t reallocations = 0;     // Texture and PBOs resized for a new resolution
+    double avgUploadMs = 0.0;       // UI thread time per upload (copy into the PBO + glTexSubImage2D)
+    double maxUploadMs = 0.0;       // Worst upload in the last window
+    double uploadMBps = 0.0;        // Pixel data streamed to the GPU over the last window
+    bool persistent = false;        // PBOs persistently mapped (GL 4.4) rather than mapped per frame
+};
+
+// Streams video frames into a GL texture through a ring of pixel unpack buffers.
+//
+// The texture is allocated once per resolution and only ever updated with
+// glTexSubImage2D sourced from a PBO, so the driver copy happens on the GPU
+// timeline instead of blocking the UI thread. Each PBO is fenced after use and
+// only rewritten once its fence has signalled; if none is free the caller
+// leaves the frame in the capture buffer and picks up the newest one later.
+// Where GL 4.4 is available the PBOs are persistently mapped, otherwise they
+// are mapped unsynchronized per frame (the fences provide the ordering).
+//
+// UYVY frames are uploaded as-is into a half-width RGBA texture (one texel
+// per U Y0 V Y1 pair) and converted to RGB by a fragment shader pass into the
+// display texture, so getTexture() is always plain RGBA whatever the source sent.
+class VideoTextureUploader {
+public:
+    static constexpr int PBO_COUNT = 3;
+
+    VideoTextureUploader();
+    ~VideoTextureUploader();
+
+    // Context must be current for all methods
+    bool initialize();
+    void shutdown();
+
+    // Retires finished uploads; true if a PBO can take the next frame
+    bool canUpload();
+
+    bool upload(const VideoFrame& frame);
+
+    GLuint getTexture() const { return texture_; }
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    VideoPixelFormat getFormat() const { return format_; }
+
+    // Rolls the upload time window over roughly once a second
+    void updateStats();
+    const VideoUploadStats& getStats() const { return stats_; }
+
+private:
+    struct Slot {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;
+        uint8_t* mapped = nullptr;  // Persistent mapping only
+    };
+
+    GLuint texture_;
+    int width_, height_;
+    int stride_;
+    VideoPixelFormat format_;
+    size_t frameBytes_;
+    bool persistentSupported_;
+    std::vector<Slot> slots_;
+    size_t nextSlot_;
+
+    // UYVY path: packed source texture and the conversion pass into texture_
+    GLuint packedTexture_;
+    GLuint convertFramebuffer_;
+    GLuint convertProgram_;
+    GLuint convertVao_;
+    GLint coefficientsLocation_;
+
+    VideoUploadStats stats_;
+    double windowUploadMs_;
+    double windowMaxMs_;
+    uint64_t windowBytes_;
+    uint64_t windowUploads_;
+    std::chrono::steady_clock::time_point windowStart_;
+
+    bool allocate(const VideoFrame& frame);
+    void releaseBuffers();
+    bool createConvertPass();
+    void convert();
+
+    static GLuint compileShader(GLenum type, const char* source);
+
+    // Full-screen triangle from gl_VertexID - no vertex buffer
+    static constexpr const char* CONVERT_VERTEX_SHADER = R"(
+        #version 330 core
+        void main() {
+            vec2 pos = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+            gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+        }
+    )";
+
+    // Studio-range 4:2:2 to RGB. Chroma is shared by each pixel pair, as the SDK's own conversion does.
+    static constexpr const char* CONVERT_FRAGMENT_SHADER = R"(
+        #version 330 core
+        out vec4 color;
+
+        uniform sampler2D source;
+        uniform vec4 coefficients;  // Cr->R, Cb->G, Cr->G, Cb->B
+
+        void main() {
+            ivec2 pixel = ivec2(gl_FragCoord.xy);
+            vec4 uyvy = texelFetch(source, ivec2(pixel.x >> 1, pixel.y), 0);
+            float luma = ((pixel.x & 1) == 0 ? uyvy.g : uyvy.a);
+            float y = (luma * 255.0 - 16.0) / 219.0;
+            float cb = (uyvy.r * 255.0 - 128.0) / 224.0;
+            float cr = (uyvy.b * 255.0 - 128.0) / 224.0;
+            color = vec4(clamp(vec3(y + coefficients.x * cr,
+                                    y - coefficients.y * cb - coefficients.z * cr,
+                                    y + coefficients.w * cb), 0.0, 1.0), 1.0);
+        }
+    )";
+};
+
+} // namespace LiveText
@@ -1,9 +1,76 @@
 #include "SenderApp.h"
+#include "common/Logger.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
-int main() {
+namespace {
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]" << std::endl;
+    std::cout << "  --ndi-uyvy     Receive NDI video as UYVY and convert it on the GPU (half the upload)" << std::endl;
+    std::cout << "  --ndi-source N Connect to the first NDI source whose name contains N (default: first found)" << std::endl;
+    std::cout << "  --synthetic    Use a scrolling test pattern instead of NDI for the video background" << std::endl;
+    std::cout << "  --video-file F     Loop raw frames from file F instead of NDI (no header, see --video-size)" << std::endl;
+    std::cout << "  --video-size WxH   Synthetic/file frame size (default 1920x1080)" << std::endl;
+    std::cout << "  --video-fps N      Synthetic/file frame rate (default 60, 0 = unpaced)" << std::endl;
+    std::cout << "  --video-format F   Synthetic/file pixel format: bgra or uyvy (default bgra)" << std::endl;
+    std::cout << "  --refresh-with-text  Put the text in every periodic state refresh (for receivers with no return path)" << std::endl;
+    std::cout << "  --present-delay MS  Show updates MS after sending, on every receiver's same frame (default 40, 0 = on arrival)" << std::endl;
+    std::cout << "  --show F       Load cue list F (cues separated by blank lines; @big/@small above a cue sets its size)" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    LiveText::SenderConfig config;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ndi-uyvy") == 0) {
+            config.ndiUYVY = true;
+        } else if (std::strcmp(argv[i], "--ndi-source") == 0 && i + 1 < argc) {
+            config.ndiSource = argv[++i];
+        } else if (std::strcmp(argv[i], "--synthetic") == 0) {
+            config.videoSource = LiveText::VideoSourceType::SYNTHETIC;
+        } else if (std::strcmp(argv[i], "--video-file") == 0 && i + 1 < argc) {
+            config.videoSource = LiveText::VideoSourceType::FILE;
+            config.videoFile = argv[++i];
+        } else if (std::strcmp(argv[i], "--video-size") == 0 && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%dx%d", &config.videoWidth, &config.videoHeight) != 2 ||
+                config.videoWidth <= 0 || config.videoHeight <= 0) {
+                std::cerr << "Invalid video size: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--video-fps") == 0 && i + 1 < argc) {
+            config.videoFps = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--video-format") == 0 && i + 1 < argc) {
+            ++i;
+            if (std::strcmp(argv[i], "bgra") == 0) {
+                config.videoFormat = LiveText::VideoPixelFormat::BGRA;
+            } else if (std::strcmp(argv[i], "uyvy") == 0) {
+                config.videoFormat = LiveText::VideoPixelFormat::UYVY;
+            } else {
+                std::cerr << "Invalid video format: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--refresh-with-text") == 0) {
+            config.refreshWithText = true;
+        } else if (std::strcmp(argv[i], "--present-delay") == 0 && i + 1 < argc) {
+            config.presentationDelayMs = std::atoi(argv[++i]);
+            if (config.presentationDelayMs < 0) {
+                std::cerr << "Invalid presentation delay: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--show") == 0 && i + 1 < argc) {
+            config.showFile = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
     try {
-        LiveText::SenderApp app;
+        LiveText::SenderApp app(config);
 
         if (!app.initialize()) {
             std::cerr << "Failed to initialize sender application" << std::endl;
@@ -16,6 +83,7 @@ int main() {
         app.run();
         app.shutdown();
 
+        LiveText::Logger::instance().shutdown();
         std::cout << "Application shutdown complete" << std::endl;
         return 0;
 
@@ -1,5 +1,6 @@
 // Network implementations - can use real UDP or stub for testing
 #include "common/AeronConnection.h"
+#include "common/TimerService.h"
 #include "network/NetworkAdapter.h"
 #include <iostream>
 #include <thread>
@@ -16,6 +17,7 @@ namespace LiveText {
 AeronPublisher::AeronPublisher(const std::string& channel, int streamId)
     : channel_(channel)
     , streamId_(streamId)
+    , heartbeatTimer_(0)
     , running_(false)
 {
 #if USE_REAL_NETWORK
@@ -54,8 +56,8 @@ bool AeronPublisher::initialize() {
     stats_.lastError.clear();
     running_ = true;
 
-    // Start heartbeat thread
-    healthCheckThread_ = std::thread(&AeronPublisher::healthCheckLoop, this);
+    // Heartbeats from the shared timer thread
+    heartbeatTimer_ = TimerService::instance().schedule(std::chrono::seconds(1), [this]() { onHeartbeatTimer(); });
 
     std::cout << "[STUB] AeronPublisher connected successfully" << std::endl;
     return true;
@@ -78,7 +80,7 @@ bool AeronPublisher::publish(const TextMessage& message) {
 
     // Simulate message publishing
     stats_.messagesPublished++;
-    stats_.bytesPublished += TextMessage::getMaxSerializedSize();
+    stats_.bytesPublished += message.getSerializedSize();
 
     std::string typeStr;
     switch (message.type) {
@@ -94,6 +96,31 @@ bool AeronPublisher::publish(const TextMessage& message) {
         case MessageType::HEARTBEAT:
             typeStr = "HEARTBEAT";
             break;
+        case MessageType::FIT_REPORT:
+            typeStr = "FIT_REPORT";
+            break;
+        case MessageType::STATE_REFRESH:
+            typeStr = "STATE_REFRESH";
+            break;
+        case MessageType::STATE_REQUEST:
+            typeStr = "STATE_REQUEST";
+            break;
+        case MessageType::CUE_PRELOAD:
+            typeStr = "CUE_PRELOAD";
+            break;
+        case MessageType::CUE_GO:
+            typeStr = "CUE_GO";
+            std::cout << "[STUB] Published GO for cue " << message.cueId << std::endl;
+            break;
+        case MessageType::CLOCK_PING:
+            typeStr = "CLOCK_PING";
+            break;
+        case MessageType::CLOCK_PONG:
+            typeStr = "CLOCK_PONG";
+            break;
+        case MessageType::PRESENT_REPORT:
+            typeStr = "PRESENT_REPORT";
+            break;
     }
 
     return true;
@@ -101,8 +128,9 @@ bool AeronPublisher::publish(const TextMessage& message) {
 
 void AeronPublisher::shutdown() {
     running_ = false;
-    if (healthCheckThread_.joinable()) {
-        healthCheckThread_.join();
+    if (heartbeatTimer_ != 0) {
+        TimerService::instance().cancel(heartbeatTimer_);
+        heartbeatTimer_ = 0;
     }
 
     stats_.isConnected = false;
@@ -113,19 +141,15 @@ bool AeronPublisher::isHealthy() const {
     return stats_.isConnected && !stats_.hasErrors;
 }
 
-void AeronPublisher::healthCheckLoop() {
-    while (running_) {
-        stats_.lastHeartbeat = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
-
-        // Publish heartbeat
-        TextMessage heartbeat = TextMessage::createHeartbeat();
-        if (stats_.isConnected) {
-            stats_.messagesPublished++;
-            stats_.bytesPublished += TextMessage::getMaxSerializedSize();
-        }
+void AeronPublisher::onHeartbeatTimer() {
+    stats_.lastHeartbeat = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
 
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    // Publish heartbeat
+    TextMessage heartbeat = TextMessage::createHeartbeat();
+    if (stats_.isConnected) {
+        stats_.messagesPublished++;
+        stats_.bytesPublished += heartbeat.getSerializedSize();
     }
 }
 